@@ -0,0 +1,61 @@
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include "hltypesUtil.h"
+#include "hstring.h"
+
+#define REPEATS 50
+
+// 1 MB of text with the searched characters only at the very end
+static hstr text = hstr('a', 1024 * 1024 - 16) + "bcdefgh,xyz;12345";
+static std::string reference = text.cStr();
+static bool failed = false;
+
+template <typename F, typename G>
+static void _measure(const char* name, F stringSearch, G referenceSearch)
+{
+	int result = 0;
+	int referenceResult = 0;
+	int64_t time = htickCount();
+	for_iter (i, 0, REPEATS)
+	{
+		result += stringSearch();
+	}
+	int64_t stringTime = htickCount() - time;
+	time = htickCount();
+	for_iter (i, 0, REPEATS)
+	{
+		referenceResult += referenceSearch();
+	}
+	int64_t referenceTime = htickCount() - time;
+	printf("%-20s %6d ms (std::string %6d ms)\n", name, (int)stringTime, (int)referenceTime);
+	if (result != referenceResult)
+	{
+		printf("ERROR: %s returned %d, std::string returned %d!\n", name, result, referenceResult);
+		failed = true;
+	}
+}
+
+static int _referenceCount(const char* what)
+{
+	int result = 0;
+	size_t length = strlen(what);
+	size_t position = reference.find(what);
+	while (position != std::string::npos)
+	{
+		++result;
+		position = reference.find(what, position + length);
+	}
+	return result;
+}
+
+int main()
+{
+	printf("String search on %d bytes, %d repeats\n", text.size(), REPEATS);
+	_measure("indexOf(char)", []() { return text.indexOf(';'); }, []() { return (int)reference.find(';'); });
+	_measure("indexOf(string)", []() { return text.indexOf("xyz;1"); }, []() { return (int)reference.find("xyz;1"); });
+	_measure("indexOfAny", []() { return text.indexOfAny(";,.:!?"); }, []() { return (int)reference.find_first_of(";,.:!?"); });
+	_measure("count", []() { return text.count("aaab"); }, []() { return _referenceCount("aaab"); });
+	return (failed ? 1 : 0);
+}
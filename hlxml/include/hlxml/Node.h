@@ -13,6 +13,7 @@
 #ifndef HLXML_NODE_H
 #define HLXML_NODE_H
 
+#include <hltypes/hatom.h>
 #include <hltypes/henum.h>
 #include <hltypes/hmap.h>
 #include <hltypes/hstring.h>
@@ -49,7 +50,7 @@ namespace hlxml
 		));
 
 		/// @brief Name of the Node.
-		hstr name;
+		hatom name;
 		/// @brief Value of the Node.
 		hstr value;
 		/// @brief Type of the Node.
@@ -32,7 +32,7 @@ namespace hlxml
 		line(0)
 	{
 		rapidxml::xml_node<char>* rapidXmlNode = RAPIDXML_NODE(node);
-		this->name = hstr(rapidXmlNode->name(), (int)rapidXmlNode->name_size());
+		this->name = hatom(rapidXmlNode->name(), (int)rapidXmlNode->name_size());
 		this->value = hstr(rapidXmlNode->value(), (int)rapidXmlNode->value_size());
 		this->type = Type::Element;
 		this->filename = document->getFilename();
@@ -13,11 +13,14 @@
 #ifndef HLTYPES_ARRAY_H
 #define HLTYPES_ARRAY_H
 
+#include <functional>
 #include <vector>
+#include <utility>
 
 #include "hcontainer.h"
 #include "hexception.h"
 #include "hltypesUtil.h"
+#include "hparallel.h"
 #include "hstring.h"
 
 /// @brief Provides a simpler syntax to iterate through an Array.
@@ -177,38 +180,79 @@ namespace hltypes
 		}
 		/// @brief Creates new Array with reversed order of elements.
 		/// @return A new Array.
-		inline Array<T> reversed() const
+		inline Array<T> reversed() const&
 		{
 			return this->template _reversed<Array<T> >();
 		}
+		/// @brief Same as reversed(), but modifies this temporary Array in-place instead of copying it.
+		/// @return This Array moved into the result.
+		inline Array<T> reversed() &&
+		{
+			this->reverse();
+			return std::move(*this);
+		}
 		/// @brief Creates new Array without duplicates.
 		/// @return A new Array.
-		inline Array<T> removedDuplicates() const
+		inline Array<T> removedDuplicates() const&
 		{
 			return this->template _removedDuplicates<Array<T> >();
 		}
+		/// @brief Same as removedDuplicates(), but modifies this temporary Array in-place instead of copying it.
+		/// @return This Array moved into the result.
+		inline Array<T> removedDuplicates() &&
+		{
+			this->removeDuplicates();
+			return std::move(*this);
+		}
 		/// @brief Creates new sorted Array.
 		/// @return A new Array.
 		/// @note The sorting order is ascending.
-		inline Array<T> sorted() const
+		inline Array<T> sorted() const&
 		{
 			return this->template _sorted<Array<T> >();
 		}
+		/// @brief Same as sorted(), but sorts this temporary Array in-place instead of copying it.
+		/// @return This Array moved into the result.
+		/// @note The sorting order is ascending.
+		inline Array<T> sorted() &&
+		{
+			this->sort();
+			return std::move(*this);
+		}
 		/// @brief Creates new sorted Array.
-		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
 		/// @return A new Array.
 		/// @note The sorting order is ascending.
 		/// @note compareFunction should return true if first element is less than the second element.
-		inline Array<T> sorted(bool (*compareFunction)(T const&, T const&)) const
+		template <typename C>
+		inline Array<T> sorted(C compareFunction) const&
 		{
 			return this->template _sorted<Array<T> >(compareFunction);
 		}
+		/// @brief Same as sorted(compareFunction), but sorts this temporary Array in-place instead of copying it.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
+		/// @return This Array moved into the result.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		template <typename C>
+		inline Array<T> sorted(C compareFunction) &&
+		{
+			this->sort(compareFunction);
+			return std::move(*this);
+		}
 		/// @brief Creates a new Array with randomized order of elements.
 		/// @return A new Array.
-		inline Array<T> randomized() const
+		inline Array<T> randomized() const&
 		{
 			return this->template _randomized<Array<T> >();
 		}
+		/// @brief Same as randomized(), but modifies this temporary Array in-place instead of copying it.
+		/// @return This Array moved into the result.
+		inline Array<T> randomized() &&
+		{
+			this->randomize();
+			return std::move(*this);
+		}
 		/// @brief Creates a new Array as union of this Array with an element.
 		/// @param[in] element Element to unite with.
 		/// @return A new Array.
@@ -259,10 +303,21 @@ namespace hltypes
 		{
 			return this->template _mapped<Array<S>, S>(generateFunction);
 		}
+		/// @brief Creates new Array with new elements obtained from the current Array elements.
+		/// @param[in] generateFunction Generation function or function object for the new elements.
+		/// @return A new Array with the new elements.
+		/// @note The type of the new elements is the return type of generateFunction.
+		template <typename F>
+		inline auto mapped(F generateFunction) const -> Array<typename std::decay<decltype(generateFunction(std::declval<const T&>()))>::type>
+		{
+			typedef typename std::decay<decltype(generateFunction(std::declval<const T&>()))>::type S;
+			return this->template _mapped<Array<S>, S>(generateFunction);
+		}
 		/// @brief Finds and returns new Array of elements that match the condition.
-		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
 		/// @return New Array with all matching elements.
-		inline Array<T> findAll(bool (*conditionFunction)(T const&)) const
+		template <typename C>
+		inline Array<T> findAll(C conditionFunction) const
 		{
 			return this->template _findAll<Array<T> >(conditionFunction);
 		}
@@ -283,6 +338,67 @@ namespace hltypes
 		{
 			return this->template _dynamicCast<Array<S>, S>(includeNulls);
 		}
+		/// @brief Sorts elements using multiple threads.
+		/// @note The sorting order is ascending.
+		/// @note The sort is stable and the result is the same as with sort(). Arrays with fewer than PARALLEL_MIN_SIZE elements are sorted on the calling thread.
+		inline void sortParallel()
+		{
+			Parallel::sort(this->begin(), this->end(), std::less<T>());
+		}
+		/// @brief Sorts elements using multiple threads.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		/// @note The sort is stable and the result is the same as with sort(). Arrays with fewer than PARALLEL_MIN_SIZE elements are sorted on the calling thread.
+		template <typename C>
+		inline void sortParallel(C compareFunction)
+		{
+			Parallel::sort(this->begin(), this->end(), compareFunction);
+		}
+		/// @brief Creates new Array with new elements obtained from the current Array elements using multiple threads.
+		/// @param[in] generateFunction Function pointer with generation function for the new elements.
+		/// @return A new Array with the new elements in the same order as with mapped().
+		/// @note generateFunction is called from multiple threads at the same time.
+		template <typename S>
+		inline Array<S> mappedParallel(S (*generateFunction)(T const&)) const
+		{
+			Array<S> result;
+			Parallel::map<typename Array<T>::const_iterator_t, Array<S>, S>(this->begin(), this->end(), result, generateFunction);
+			return result;
+		}
+		/// @brief Creates new Array with new elements obtained from the current Array elements using multiple threads.
+		/// @param[in] generateFunction Generation function or function object for the new elements.
+		/// @return A new Array with the new elements in the same order as with mapped().
+		/// @note generateFunction is called from multiple threads at the same time.
+		/// @note The type of the new elements is the return type of generateFunction.
+		template <typename F>
+		inline auto mappedParallel(F generateFunction) const -> Array<typename std::decay<decltype(generateFunction(std::declval<const T&>()))>::type>
+		{
+			typedef typename std::decay<decltype(generateFunction(std::declval<const T&>()))>::type S;
+			Array<S> result;
+			Parallel::map<typename Array<T>::const_iterator_t, Array<S>, S>(this->begin(), this->end(), result, generateFunction);
+			return result;
+		}
+		/// @brief Finds and returns new Array of elements that match the condition using multiple threads.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
+		/// @return New Array with all matching elements in the same order as with findAll().
+		/// @note conditionFunction is called from multiple threads at the same time.
+		template <typename C>
+		inline Array<T> findAllParallel(C conditionFunction) const
+		{
+			Array<T> result;
+			Parallel::findAll(this->begin(), this->end(), result, conditionFunction);
+			return result;
+		}
+		/// @brief Counts occurrences of elements that match the condition using multiple threads.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
+		/// @return Number of matching elements.
+		/// @note conditionFunction is called from multiple threads at the same time.
+		template <typename C>
+		inline int countParallel(C conditionFunction) const
+		{
+			return Parallel::count(this->begin(), this->end(), conditionFunction);
+		}
 		/// @brief Returns element at specified position.
 		/// @param[in] index Index of the element.
 		/// @return Element at specified position.
@@ -327,6 +443,13 @@ namespace hltypes
 			return (*this);
 		}
 		/// @brief Same as add.
+		/// @see add(T&& element)
+		inline Array<T>& operator<<(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
 		/// @see add(const Array<T>& other)
 		inline Array<T>& operator<<(const Array<T>& other)
 		{
@@ -341,6 +464,13 @@ namespace hltypes
 			return (*this);
 		}
 		/// @brief Same as add.
+		/// @see add(T&& element)
+		inline Array<T>& operator+=(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
 		/// @see add(const Array<T>& other)
 		inline Array<T>& operator+=(const Array<T>& other)
 		{
@@ -0,0 +1,137 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides interned strings with constant-time comparison.
+
+#ifndef HLTYPES_ATOM_H
+#define HLTYPES_ATOM_H
+
+#include "hhash.h"
+#include "hltypesExport.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief Handle to a String stored in a global, thread-safe interning table.
+	/// @note Every distinct string is stored only once and is never released so handles stay valid for the lifetime of the process.
+	/// Equality and hashing are O(1) which makes Atom well suited for tags, names and keys that recur often.
+	class hltypesExport Atom
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @note Creates an Atom of the empty string.
+		Atom();
+		/// @brief Constructor.
+		/// @param[in] string C-type string value.
+		Atom(const char* string);
+		/// @brief Constructor.
+		/// @param[in] string C-type string value.
+		/// @param[in] length Length of the C-type string.
+		Atom(const char* string, int length);
+		/// @brief Constructor.
+		/// @param[in] string String value.
+		Atom(const String& string);
+
+		/// @brief Gets the interned String.
+		/// @return The interned String.
+		inline const String& str() const { return this->entry->string; }
+		/// @brief Gets the interned String as C-string.
+		/// @return The C-string.
+		inline const char* cStr() const { return this->entry->string.cStr(); }
+		/// @brief Gets the length of the interned String.
+		/// @return Length of the interned String.
+		inline int size() const { return this->entry->string.size(); }
+		/// @brief Gets the precalculated hash of the interned String.
+		/// @return Hash of the interned String.
+		inline unsigned int getHash() const { return this->entry->hash; }
+		/// @brief Gets the unique ID of the interned String.
+		/// @return Unique ID of the interned String.
+		/// @note IDs are assigned in order of interning.
+		inline unsigned int getId() const { return this->entry->id; }
+
+		/// @brief Casts the Atom to its interned String.
+		inline operator const String&() const { return this->entry->string; }
+
+		/// @brief Same as equals.
+		/// @param[in] other Other Atom.
+		/// @return True if Atoms are equal.
+		inline bool operator==(const Atom& other) const { return (this->entry == other.entry); }
+		/// @brief Same as not equals.
+		/// @param[in] other Other Atom.
+		/// @return True if Atoms are not equal.
+		inline bool operator!=(const Atom& other) const { return (this->entry != other.entry); }
+		/// @brief Same as less than.
+		/// @param[in] other Other Atom.
+		/// @return True if this Atom was interned before the other Atom.
+		/// @note This compares IDs, not the strings themselves, so it can be used for keys in Map, but it does not result in a lexicographical order.
+		inline bool operator<(const Atom& other) const { return (this->entry->id < other.entry->id); }
+		/// @brief Same as equals.
+		/// @param[in] string String value.
+		/// @return True if the interned String and the String are equal.
+		inline bool operator==(const String& string) const { return (this->entry->string == string); }
+		/// @brief Same as not equals.
+		/// @param[in] string String value.
+		/// @return True if the interned String and the String are not equal.
+		inline bool operator!=(const String& string) const { return (this->entry->string != string); }
+		/// @brief Same as equals.
+		/// @param[in] string C-type string value.
+		/// @return True if the interned String and the C-type string are equal.
+		inline bool operator==(const char* string) const { return (this->entry->string == string); }
+		/// @brief Same as not equals.
+		/// @param[in] string C-type string value.
+		/// @return True if the interned String and the C-type string are not equal.
+		inline bool operator!=(const char* string) const { return (this->entry->string != string); }
+
+		/// @brief Gets the number of Strings in the interning table.
+		/// @return Number of Strings in the interning table.
+		static int getCount();
+
+	protected:
+		/// @brief An entry in the interning table.
+		struct Entry
+		{
+			/// @brief The interned String.
+			String string;
+			/// @brief Precalculated hash of the String.
+			unsigned int hash;
+			/// @brief Unique ID.
+			unsigned int id;
+		};
+
+		/// @brief The entry in the interning table.
+		const Entry* entry;
+
+		/// @brief Finds or creates the entry of a String in the interning table.
+		/// @param[in] string String value.
+		/// @return The entry in the interning table.
+		static const Entry* _intern(const String& string);
+
+	};
+
+	/// @brief Hash functor for Atom.
+	template <>
+	struct Hash<Atom>
+	{
+		/// @brief Whether hashing is supported for T.
+		static const bool Enabled = true;
+		/// @brief Calculates the hash of a value.
+		/// @param[in] value The value.
+		/// @return The hash value.
+		inline size_t operator()(const Atom& value) const
+		{
+			return value.getHash();
+		}
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::Atom hatom;
+
+#endif
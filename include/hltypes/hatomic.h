@@ -0,0 +1,219 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides a value with atomic operations for lock-free multithreading.
+
+#ifndef HLTYPES_ATOMIC_H
+#define HLTYPES_ATOMIC_H
+
+#include <atomic>
+
+/// @brief Assumed size of a CPU cache line, used to keep data of different threads apart.
+#define HL_CACHE_LINE_SIZE 64
+
+namespace hltypes
+{
+	/// @brief Value with atomic operations that can be safely accessed from several threads without a Mutex.
+	/// @note Every operation takes an explicit memory order. The default is sequential consistency which is the safest and the slowest.
+	/// @note T has to be trivially copyable. Arithmetic and bitwise operations are only available for integral types, addition and subtraction also for pointers.
+	template <typename T>
+	class Atomic
+	{
+	public:
+		/// @brief Empty constructor.
+		/// @note The value is initialized with T().
+		inline Atomic() : value(T())
+		{
+		}
+		/// @brief Basic constructor.
+		/// @param[in] value Initial value.
+		inline Atomic(T value) : value(value)
+		{
+		}
+		/// @brief Copy constructor.
+		/// @param[in] other Atomic to copy.
+		/// @note Only loading the other value is atomic, not the copy as a whole.
+		inline Atomic(const Atomic<T>& other) : value(other.load())
+		{
+		}
+
+		/// @brief Loads the value.
+		/// @param[in] order Memory order of the operation.
+		/// @return The value.
+		inline T load(std::memory_order order = std::memory_order_seq_cst) const
+		{
+			return this->value.load(order);
+		}
+		/// @brief Stores a new value.
+		/// @param[in] value The new value.
+		/// @param[in] order Memory order of the operation.
+		inline void store(T value, std::memory_order order = std::memory_order_seq_cst)
+		{
+			this->value.store(value, order);
+		}
+		/// @brief Stores a new value and returns the previous one.
+		/// @param[in] value The new value.
+		/// @param[in] order Memory order of the operation.
+		/// @return The previous value.
+		inline T exchange(T value, std::memory_order order = std::memory_order_seq_cst)
+		{
+			return this->value.exchange(value, order);
+		}
+		/// @brief Stores a new value if the current value equals an expected value.
+		/// @param[in,out] expected The expected value. If the values are not equal, it is set to the current value.
+		/// @param[in] desired The new value.
+		/// @param[in] order Memory order of the operation.
+		/// @return True if the new value was stored.
+		/// @note If the operation fails, order is used without its release part (acq_rel becomes acquire, release becomes relaxed).
+		inline bool compareExchange(T& expected, T desired, std::memory_order order = std::memory_order_seq_cst)
+		{
+			return this->value.compare_exchange_strong(expected, desired, order);
+		}
+		/// @brief Stores a new value if the current value equals an expected value.
+		/// @param[in,out] expected The expected value. If the values are not equal, it is set to the current value.
+		/// @param[in] desired The new value.
+		/// @param[in] order Memory order of the operation if it succeeds.
+		/// @param[in] failureOrder Memory order of the operation if it fails. It can't be stronger than order.
+		/// @return True if the new value was stored.
+		inline bool compareExchange(T& expected, T desired, std::memory_order order, std::memory_order failureOrder)
+		{
+			return this->value.compare_exchange_strong(expected, desired, order, failureOrder);
+		}
+		/// @brief Stores a new value if the current value equals an expected value, but can fail spuriously.
+		/// @param[in,out] expected The expected value. If the values are not equal, it is set to the current value.
+		/// @param[in] desired The new value.
+		/// @param[in] order Memory order of the operation.
+		/// @return True if the new value was stored.
+		/// @note If the operation fails, order is used without its release part (acq_rel becomes acquire, release becomes relaxed).
+		/// @note This is faster than compareExchange() on some platforms when it's used in a loop anyway.
+		inline bool compareExchangeWeak(T& expected, T desired, std::memory_order order = std::memory_order_seq_cst)
+		{
+			return this->value.compare_exchange_weak(expected, desired, order);
+		}
+		/// @brief Stores a new value if the current value equals an expected value, but can fail spuriously.
+		/// @param[in,out] expected The expected value. If the values are not equal, it is set to the current value.
+		/// @param[in] desired The new value.
+		/// @param[in] order Memory order of the operation if it succeeds.
+		/// @param[in] failureOrder Memory order of the operation if it fails. It can't be stronger than order.
+		/// @return True if the new value was stored.
+		/// @note This is faster than compareExchange() on some platforms when it's used in a loop anyway.
+		inline bool compareExchangeWeak(T& expected, T desired, std::memory_order order, std::memory_order failureOrder)
+		{
+			return this->value.compare_exchange_weak(expected, desired, order, failureOrder);
+		}
+		/// @brief Adds to the value.
+		/// @param[in] value Value to add.
+		/// @param[in] order Memory order of the operation.
+		/// @return The previous value.
+		template <typename D>
+		inline T fetchAdd(D value, std::memory_order order = std::memory_order_seq_cst)
+		{
+			return this->value.fetch_add(value, order);
+		}
+		/// @brief Subtracts from the value.
+		/// @param[in] value Value to subtract.
+		/// @param[in] order Memory order of the operation.
+		/// @return The previous value.
+		template <typename D>
+		inline T fetchSub(D value, std::memory_order order = std::memory_order_seq_cst)
+		{
+			return this->value.fetch_sub(value, order);
+		}
+		/// @brief Applies a bitwise AND to the value.
+		/// @param[in] value The other operand.
+		/// @param[in] order Memory order of the operation.
+		/// @return The previous value.
+		inline T fetchAnd(T value, std::memory_order order = std::memory_order_seq_cst)
+		{
+			return this->value.fetch_and(value, order);
+		}
+		/// @brief Applies a bitwise OR to the value.
+		/// @param[in] value The other operand.
+		/// @param[in] order Memory order of the operation.
+		/// @return The previous value.
+		inline T fetchOr(T value, std::memory_order order = std::memory_order_seq_cst)
+		{
+			return this->value.fetch_or(value, order);
+		}
+		/// @brief Applies a bitwise XOR to the value.
+		/// @param[in] value The other operand.
+		/// @param[in] order Memory order of the operation.
+		/// @return The previous value.
+		inline T fetchXor(T value, std::memory_order order = std::memory_order_seq_cst)
+		{
+			return this->value.fetch_xor(value, order);
+		}
+		/// @brief Checks whether the operations are implemented without any locks.
+		/// @return True if the operations are implemented without any locks.
+		inline bool isLockFree() const
+		{
+			return this->value.is_lock_free();
+		}
+
+		/// @brief Loads the value with sequential consistency.
+		/// @return The value.
+		inline operator T() const
+		{
+			return this->load();
+		}
+		/// @brief Stores a new value with sequential consistency.
+		/// @param[in] value The new value.
+		/// @return The new value.
+		inline T operator=(T value)
+		{
+			this->store(value);
+			return value;
+		}
+		/// @brief Assignment operator.
+		/// @param[in] other Atomic to copy.
+		/// @return This Atomic.
+		/// @note Only loading the other value and storing it are atomic, not the copy as a whole.
+		inline Atomic<T>& operator=(const Atomic<T>& other)
+		{
+			this->store(other.load());
+			return (*this);
+		}
+		/// @brief Increments the value with sequential consistency.
+		/// @return The new value.
+		inline T operator++()
+		{
+			return (this->fetchAdd(1) + 1);
+		}
+		/// @brief Increments the value with sequential consistency.
+		/// @return The previous value.
+		inline T operator++(int)
+		{
+			return this->fetchAdd(1);
+		}
+		/// @brief Decrements the value with sequential consistency.
+		/// @return The new value.
+		inline T operator--()
+		{
+			return (this->fetchSub(1) - 1);
+		}
+		/// @brief Decrements the value with sequential consistency.
+		/// @return The previous value.
+		inline T operator--(int)
+		{
+			return this->fetchSub(1);
+		}
+
+	protected:
+		/// @brief The value.
+		std::atomic<T> value;
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+#define hatomic hltypes::Atomic
+
+#endif
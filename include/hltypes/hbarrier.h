@@ -0,0 +1,74 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides functionality of a reusable barrier for multithreading.
+
+#ifndef HLTYPES_BARRIER_H
+#define HLTYPES_BARRIER_H
+
+#include "hconditionvariable.h"
+#include "hltypesExport.h"
+#include "hmutex.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief Provides functionality of a barrier that blocks threads until a fixed number of threads has arrived.
+	/// @note The Barrier resets itself once all threads have arrived so it can be used for every step of an iterative algorithm.
+	class hltypesExport Barrier
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @param[in] count Number of threads that have to arrive before they are released.
+		/// @param[in] name The internal name.
+		Barrier(int count, const String& name = "");
+		/// @brief Destructor.
+		~Barrier();
+
+		/// @brief Returns the barrier name.
+		/// @return The barrier name.
+		inline String getName() const { return this->name; }
+		/// @brief Gets the number of threads that have to arrive before they are released.
+		/// @return The number of threads that have to arrive before they are released.
+		inline int getCount() const { return this->count; }
+
+		/// @brief Waits until all threads have arrived.
+		/// @return True for exactly one thread of each phase, the one that arrived last.
+		bool wait();
+
+	protected:
+		/// @brief Barrier name.
+		String name;
+		/// @brief Number of threads that have to arrive.
+		int count;
+		/// @brief Number of threads that have arrived in the current phase.
+		int arrived;
+		/// @brief Counter of completed phases so threads of a previous phase aren't confused with threads of the next one.
+		unsigned int generation;
+		/// @brief Mutex for the counters.
+		Mutex mutex;
+		/// @brief Condition variable that waiting threads block on.
+		ConditionVariable condition;
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		Barrier(const Barrier& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		Barrier& operator=(Barrier& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::Barrier hbarrier;
+
+#endif
@@ -0,0 +1,236 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides a bidirectional map with fast lookups in both directions.
+
+#ifndef HLTYPES_BI_MAP_H
+#define HLTYPES_BI_MAP_H
+
+#include "harray.h"
+#include "hexception.h"
+#include "hltypesUtil.h"
+#include "hmap.h"
+
+namespace hltypes
+{
+	/// @brief Bidirectional map where both keys and values are unique.
+	/// @note Keys and values are each indexed by their own Map so keyOf() and hasValue() are O(log n) instead of a linear search like in Map.
+	/// @note Both K and V need operator<. Entries can't be modified in place, they have to be changed with insert().
+	template <typename K, typename V>
+	class BiMap
+	{
+	public:
+		/// @brief Iterator type exposure.
+		typedef typename Map<K, V>::const_iterator_t const_iterator_t;
+
+		/// @brief Empty constructor.
+		inline BiMap()
+		{
+		}
+		/// @brief Constructor from a Map.
+		/// @param[in] other Map to copy.
+		/// @note If other contains duplicate values, only the entry with the last key of each value is kept.
+		inline BiMap(const Map<K, V>& other)
+		{
+			for (typename Map<K, V>::const_iterator_t it = other.begin(), itEnd = other.end(); it != itEnd; ++it)
+			{
+				this->insert(it->first, it->second);
+			}
+		}
+		/// @brief Gets the iterator at the beginning, entries are ordered by key.
+		/// @return The iterator object.
+		inline const_iterator_t begin() const
+		{
+			return this->forward.begin();
+		}
+		/// @brief Gets the iterator at the end.
+		/// @return The iterator object.
+		inline const_iterator_t end() const
+		{
+			return this->forward.end();
+		}
+		/// @brief Same as keyOf.
+		/// @see keyOf
+		inline K operator()(const V& value) const
+		{
+			return this->keyOf(value);
+		}
+		/// @brief Same as equals.
+		/// @see equals
+		inline bool operator==(const BiMap<K, V>& other) const
+		{
+			return this->equals(other);
+		}
+		/// @brief Same as nequals.
+		/// @see nequals
+		inline bool operator!=(const BiMap<K, V>& other) const
+		{
+			return this->nequals(other);
+		}
+		/// @brief Gets the Map from keys to values.
+		/// @return The Map from keys to values.
+		inline const Map<K, V>& getForward() const
+		{
+			return this->forward;
+		}
+		/// @brief Gets the Map from values to keys.
+		/// @return The Map from values to keys.
+		inline const Map<V, K>& getReverse() const
+		{
+			return this->reverse;
+		}
+		/// @brief Returns the number of entries.
+		/// @return The number of entries.
+		inline int size() const
+		{
+			return this->forward.size();
+		}
+		/// @brief Removes all entries.
+		inline void clear()
+		{
+			this->forward.clear();
+			this->reverse.clear();
+		}
+		/// @brief Returns an Array with all keys ordered by key.
+		/// @return An Array with all keys.
+		inline Array<K> keys() const
+		{
+			return this->forward.keys();
+		}
+		/// @brief Returns an Array with all values ordered by key.
+		/// @return An Array with all values.
+		inline Array<V> values() const
+		{
+			return this->forward.values();
+		}
+		/// @brief Compares the contents of two BiMaps for being equal.
+		/// @param[in] other Another BiMap.
+		/// @return True if all pairs of keys and values are equal.
+		inline bool equals(const BiMap<K, V>& other) const
+		{
+			return this->forward.equals(other.forward);
+		}
+		/// @brief Compares the contents of two BiMaps for being not equal.
+		/// @param[in] other Another BiMap.
+		/// @return True if at least one pair of keys and values is not equal.
+		inline bool nequals(const BiMap<K, V>& other) const
+		{
+			return this->forward.nequals(other.forward);
+		}
+		/// @brief Returns key of specified value.
+		/// @param[in] value Value with the given key.
+		/// @return Key of specified value.
+		inline K keyOf(const V& value) const
+		{
+			typename Map<V, K>::const_iterator_t it = this->reverse.find(value);
+			if (it == this->reverse.end())
+			{
+				throw ContainerElementNotFoundException();
+			}
+			return it->second;
+		}
+		/// @brief Returns value of specified key.
+		/// @param[in] key Key of the given value.
+		/// @return Value of specified key.
+		inline V valueOf(const K& key) const
+		{
+			const_iterator_t it = this->forward.find(key);
+			if (it == this->forward.end())
+			{
+				throw ContainerElementNotFoundException();
+			}
+			return it->second;
+		}
+		/// @brief Checks for existence of a key.
+		/// @param[in] key Key to check.
+		/// @return True if key is present.
+		inline bool hasKey(const K& key) const
+		{
+			return (this->forward.find(key) != this->forward.end());
+		}
+		/// @brief Checks for existence of a value.
+		/// @param[in] value Value to check.
+		/// @return True if value is present.
+		inline bool hasValue(const V& value) const
+		{
+			return (this->reverse.find(value) != this->reverse.end());
+		}
+		/// @brief Adds a new pair of key and value.
+		/// @param[in] key Key of the entry.
+		/// @param[in] value Value of the entry.
+		/// @note Existing entries with the same key or the same value are removed first.
+		inline void insert(const K& key, const V& value)
+		{
+			this->removeKey(key);
+			this->removeValue(value);
+			this->forward.insert(key, value);
+			this->reverse.insert(value, key);
+		}
+		/// @brief Removes a pair of key and value specified by a key.
+		/// @param[in] key Key of the entry.
+		/// @return True if key was present and removed.
+		inline bool removeKey(const K& key)
+		{
+			typename Map<K, V>::iterator_t it = this->forward.find(key);
+			if (it == this->forward.end())
+			{
+				return false;
+			}
+			this->reverse.erase(it->second);
+			this->forward.erase(it);
+			return true;
+		}
+		/// @brief Removes a pair of key and value specified by a value.
+		/// @param[in] value Value of the entry.
+		/// @return True if value was present and removed.
+		inline bool removeValue(const V& value)
+		{
+			typename Map<V, K>::iterator_t it = this->reverse.find(value);
+			if (it == this->reverse.end())
+			{
+				return false;
+			}
+			this->forward.erase(it->second);
+			this->reverse.erase(it);
+			return true;
+		}
+		/// @brief Finds and returns value stored at key. In case no value is found, returns the given default value.
+		/// @param[in] key Key to retrieve the value of.
+		/// @param[in] defaultValue Default value to return if key does not exist.
+		/// @return Value stored at key or given default value.
+		inline V tryGet(const K& key, const V& defaultValue) const
+		{
+			const_iterator_t it = this->forward.find(key);
+			return (it != this->forward.end() ? it->second : defaultValue);
+		}
+		/// @brief Finds and returns key of a value. In case no key is found, returns the given default key.
+		/// @param[in] value Value to retrieve the key of.
+		/// @param[in] defaultKey Default key to return if value does not exist.
+		/// @return Key of value or given default key.
+		inline K tryGetKey(const V& value, const K& defaultKey) const
+		{
+			typename Map<V, K>::const_iterator_t it = this->reverse.find(value);
+			return (it != this->reverse.end() ? it->second : defaultKey);
+		}
+
+	protected:
+		/// @brief Index from keys to values.
+		Map<K, V> forward;
+		/// @brief Index from values to keys.
+		Map<V, K> reverse;
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+#define hbimap hltypes::BiMap
+
+#endif
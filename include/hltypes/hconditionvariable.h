@@ -0,0 +1,72 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides functionality of a condition variable for multithreading.
+
+#ifndef HLTYPES_CONDITION_VARIABLE_H
+#define HLTYPES_CONDITION_VARIABLE_H
+
+#include "hltypesExport.h"
+#include "hmutex.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief Provides functionality of a condition variable for multithreading.
+	/// @note Threads block in the OS while waiting instead of polling so they don't use any CPU time.
+	/// @note Waits can wake up spuriously so the waited-for condition should always be checked again in a loop.
+	class hltypesExport ConditionVariable
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @param[in] name The internal name.
+		ConditionVariable(const String& name = "");
+		/// @brief Destructor.
+		~ConditionVariable();
+
+		/// @brief Returns the condition variable name.
+		/// @return The condition variable name.
+		inline String getName() const { return this->name; }
+
+		/// @brief Unlocks the Mutex of the ScopeLock, waits until the condition variable is signaled and locks the Mutex again.
+		/// @param[in] lock The ScopeLock that holds the locked Mutex.
+		/// @note Does nothing if the ScopeLock doesn't hold a Mutex.
+		void wait(Mutex::ScopeLock* lock);
+		/// @brief Unlocks the Mutex of the ScopeLock, waits until the condition variable is signaled or the timeout ran out and locks the Mutex again.
+		/// @param[in] lock The ScopeLock that holds the locked Mutex.
+		/// @param[in] timeout Maximum time to wait in milliseconds.
+		/// @return False if the timeout ran out or the ScopeLock doesn't hold a Mutex.
+		bool wait(Mutex::ScopeLock* lock, float timeout);
+		/// @brief Wakes up one waiting thread.
+		void signal();
+		/// @brief Wakes up all waiting threads.
+		void broadcast();
+
+	protected:
+		/// @brief Condition variable OS handle.
+		void* handle;
+		/// @brief Condition variable name.
+		String name;
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		ConditionVariable(const ConditionVariable& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		ConditionVariable& operator=(ConditionVariable& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::ConditionVariable hconditionvariable;
+
+#endif
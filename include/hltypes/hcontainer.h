@@ -14,9 +14,14 @@
 #define HLTYPES_CONTAINER_H
 
 #include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "hexception.h"
+#include "hhash.h"
 #include "hltypesUtil.h"
 #include "hplatform.h"
 #include "hstring.h"
@@ -44,9 +49,14 @@ namespace hltypes
 		/// @brief Copy constructor.
 		/// @param[in] other Container to copy.
 		inline Container(const Container& other) :
-			STD()
+			STD((const STD&)other)
+		{
+		}
+		/// @brief Move constructor.
+		/// @param[in] other Container to move.
+		inline Container(Container&& other) noexcept(std::is_nothrow_move_constructible<STD>::value) :
+			STD(std::move((STD&)other))
 		{
-			this->insertAt(0, other);
 		}
 		/// @brief Constructor from single element.
 		/// @param[in] element Element to insert.
@@ -98,6 +108,22 @@ namespace hltypes
 		{
 			this->insertAt(0, other, start, count);
 		}
+		/// @brief Assignment operator.
+		/// @param[in] other Container to copy.
+		/// @return This Container.
+		inline Container& operator=(const Container& other)
+		{
+			STD::operator=((const STD&)other);
+			return (*this);
+		}
+		/// @brief Move assignment operator.
+		/// @param[in] other Container to move.
+		/// @return This Container.
+		inline Container& operator=(Container&& other) noexcept(std::is_nothrow_move_assignable<STD>::value)
+		{
+			STD::operator=(std::move((STD&)other));
+			return (*this);
+		}
 		/// @brief Returns the number of elements in the Container.
 		/// @return The number of elements in the Container.
 		inline int size() const
@@ -168,15 +194,16 @@ namespace hltypes
 		/// @return True if number of elements are equal and all pairs of elements at the same positions are equal.
 		inline bool equals(const Container& other) const
 		{
-			int size = this->size();
-			if (size != other.size())
+			if (this->size() != other.size())
 			{
 				return false;
 			}
-			for_iter (i, 0, size)
+			const_iterator_t end = STD::end();
+			const_iterator_t otherIt = other.begin();
+			for (const_iterator_t it = STD::begin(); it != end; ++it, ++otherIt)
 			{
 				// making sure operator== is used, not !=
-				if (!(this->at(i) == other.at(i)))
+				if (!((*it) == (*otherIt)))
 				{
 					return false;
 				}
@@ -188,15 +215,16 @@ namespace hltypes
 		/// @return True if number of elements are not equal or at least one pair of elements at the same positions is not equal.
 		inline bool nequals(const Container& other) const
 		{
-			int size = this->size();
-			if (size != other.size())
+			if (this->size() != other.size())
 			{
 				return true;
 			}
-			for_iter (i, 0, size)
+			const_iterator_t end = STD::end();
+			const_iterator_t otherIt = other.begin();
+			for (const_iterator_t it = STD::begin(); it != end; ++it, ++otherIt)
 			{
 				// making sure operator!= is used, not ==
-				if (this->at(i) != other.at(i))
+				if ((*it) != (*otherIt))
 				{
 					return true;
 				}
@@ -266,12 +294,13 @@ namespace hltypes
 		/// @return Index of the given element or -1 if element could not be found.
 		inline int indexOf(const T& element) const
 		{
-			int size = this->size();
-			for_iter (i, 0, size)
+			int index = 0;
+			const_iterator_t end = STD::end();
+			for (const_iterator_t it = STD::begin(); it != end; ++it, ++index)
 			{
-				if (element == this->at(i))
+				if (element == (*it))
 				{
-					return i;
+					return index;
 				}
 			}
 			return -1;
@@ -281,17 +310,17 @@ namespace hltypes
 		/// @return True if element is in Container.
 		inline bool has(const T& element) const
 		{
-			return (this->indexOf(element) >= 0);
+			return (this->_find(element) != STD::end());
 		}
 		/// @brief Checks existence of elements in Container.
 		/// @param[in] other Container with elements to search for.
 		/// @return True if all elements are in Container.
 		inline bool has(const Container& other) const
 		{
-			int size = other.size();
-			for_iter (i, 0, size)
+			const_iterator_t end = other.end();
+			for (const_iterator_t it = other.begin(); it != end; ++it)
 			{
-				if (this->indexOf(other.at(i)) < 0)
+				if (!this->has(*it))
 				{
 					return false;
 				}
@@ -306,7 +335,7 @@ namespace hltypes
 		{
 			for_iter (i, 0, count)
 			{
-				if (this->indexOf(other[i]) < 0)
+				if (!this->has(other[i]))
 				{
 					return false;
 				}
@@ -318,10 +347,10 @@ namespace hltypes
 		/// @return True if any element is in Container.
 		inline bool hasAny(const Container& other) const
 		{
-			int size = other.size();
-			for_iter (i, 0, size)
+			const_iterator_t end = other.end();
+			for (const_iterator_t it = other.begin(); it != end; ++it)
 			{
-				if (this->indexOf(other.at(i)) >= 0)
+				if (this->has(*it))
 				{
 					return true;
 				}
@@ -336,7 +365,7 @@ namespace hltypes
 		{
 			for_iter (i, 0, count)
 			{
-				if (this->indexOf(other[i]) >= 0)
+				if (this->has(other[i]))
 				{
 					return true;
 				}
@@ -349,10 +378,10 @@ namespace hltypes
 		inline int count(const T& element) const
 		{
 			int result = 0;
-			int size = this->size();
-			for_iter (i, 0, size)
+			const_iterator_t end = STD::end();
+			for (const_iterator_t it = STD::begin(); it != end; ++it)
 			{
-				if (element == this->at(i))
+				if (element == (*it))
 				{
 					++result;
 				}
@@ -365,10 +394,10 @@ namespace hltypes
 		inline int count(const Container& other) const
 		{
 			int result = 0;
-			int count = other.size();
-			for_iter (i, 0, count)
+			const_iterator_t end = other.end();
+			for (const_iterator_t it = other.begin(); it != end; ++it)
 			{
-				result += this->count(other[i]);
+				result += this->count(*it);
 			}
 			return result;
 		}
@@ -386,15 +415,17 @@ namespace hltypes
 			return result;
 		}
 		/// @brief Counts on how many elements match the condition.
-		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
 		/// @return Number of matches.
-		inline int count(bool (*conditionFunction)(T const&)) const
+		/// @note Only considered if conditionFunction can be called with an element so count(element) keeps working with elements that are implicitly converted to T.
+		template <typename C>
+		inline auto count(C conditionFunction) const -> decltype((void)conditionFunction(std::declval<const T&>()), int())
 		{
 			int result = 0;
-			int size = this->size();
-			for_iter (i, 0, size)
+			const_iterator_t end = STD::end();
+			for (const_iterator_t it = STD::begin(); it != end; ++it)
 			{
-				if (conditionFunction(this->at(i)))
+				if (conditionFunction(*it))
 				{
 					++result;
 				}
@@ -413,6 +444,17 @@ namespace hltypes
 			}
 			STD::insert(this->_itAdvance(STD::begin(), index), times, element);
 		}
+		/// @brief Inserts new element at specified position by moving it.
+		/// @param[in] index Position where to insert the new element.
+		/// @param[in] element Element to insert.
+		inline void insertAt(const int index, T&& element)
+		{
+			if (index < 0 || index > this->size())
+			{
+				throw ContainerIndexException(index);
+			}
+			STD::insert(this->_itAdvance(STD::begin(), index), std::move(element));
+		}
 		/// @brief Inserts all elements of another Container into this one.
 		/// @param[in] index Position where to insert the new elements.
 		/// @param[in] other Container of elements to insert.
@@ -482,6 +524,31 @@ namespace hltypes
 		{
 			STD::push_back(element);
 		}
+		/// @brief Adds element at the end of Container by moving it.
+		/// @param[in] element Element to add.
+		inline void add(T&& element)
+		{
+			STD::push_back(std::move(element));
+		}
+		/// @brief Constructs a new element in-place at the end of Container.
+		/// @param[in] args Arguments for the constructor of the element.
+		template <typename... Args>
+		inline void emplace(Args&&... args)
+		{
+			STD::emplace_back(std::forward<Args>(args)...);
+		}
+		/// @brief Constructs a new element in-place at specified position.
+		/// @param[in] index Position where to construct the new element.
+		/// @param[in] args Arguments for the constructor of the element.
+		template <typename... Args>
+		inline void emplaceAt(const int index, Args&&... args)
+		{
+			if (index < 0 || index > this->size())
+			{
+				throw ContainerIndexException(index);
+			}
+			STD::emplace(this->_itAdvance(STD::begin(), index), std::forward<Args>(args)...);
+		}
 		/// @brief Adds element at the end of Container n times.
 		/// @param[in] element Element to add.
 		/// @param[in] times Number of times to add the element.
@@ -583,7 +650,7 @@ namespace hltypes
 				throw ContainerIndexException(index);
 			}
 			iterator_t it = this->_itAdvance(STD::begin(), index);
-			T result = (*it);
+			T result = std::move(*it);
 			STD::erase(it);
 			return result;
 		}
@@ -591,27 +658,32 @@ namespace hltypes
 		/// @param[in] element Element to remove.
 		inline void remove(T element)
 		{
-			int index = this->indexOf(element);
-			if (index < 0)
+			iterator_t it = this->_find(element);
+			if (it == STD::end())
 			{
 				throw ContainerElementNotFoundException();
 			}
-			STD::erase(this->_itAdvance(STD::begin(), index));
+			STD::erase(it);
 		}
 		/// @brief Removes first occurrence of each element in another Container from this one.
 		/// @param[in] other Container of elements to remove.
 		inline void remove(const Container& other)
 		{
-			int size = other.size();
-			int index = 0;
-			for_iter (i, 0, size)
+			if (this == &other)
+			{
+				STD::clear();
+				return;
+			}
+			iterator_t it;
+			const_iterator_t end = other.end();
+			for (const_iterator_t otherIt = other.begin(); otherIt != end; ++otherIt)
 			{
-				index = this->indexOf(other.at(i));
-				if (index < 0)
+				it = this->_find(*otherIt);
+				if (it == STD::end())
 				{
 					throw ContainerElementNotFoundException();
 				}
-				STD::erase(this->_itAdvance(STD::begin(), index));
+				STD::erase(it);
 			}
 		}
 		/// @brief Removes first element of Container.
@@ -628,7 +700,7 @@ namespace hltypes
 			{
 				throw ContainerIndexException(0);
 			}
-			T element = STD::back();
+			T element = std::move(STD::back());
 			STD::pop_back();
 			return element;
 		}
@@ -641,50 +713,85 @@ namespace hltypes
 			{
 				throw ContainerEmptyException("removeRandom()");
 			}
-			int index = 0;
+			iterator_t it = STD::begin();
 			if (size > 1)
 			{
-				index = hrand(size);
+				std::advance(it, hrand(size));
 			}
-			T result = this->at(index);
-			this->removeAt(index);
+			T result = std::move(*it);
+			STD::erase(it);
 			return result;
 		}
+		/// @brief Removes element at given index by moving the last element into its place.
+		/// @param[in] index Index of element to remove.
+		/// @return The removed element.
+		/// @note This changes the order of elements, but unlike removeAt it doesn't have to move all following elements.
+		inline T removeAtUnordered(int index)
+		{
+			int size = this->size();
+			if (index < 0)
+			{
+				index += size;
+			}
+			if (index < 0 || index >= size)
+			{
+				throw ContainerIndexException(index);
+			}
+			iterator_t it = this->_itAdvance(STD::begin(), index);
+			T result = std::move(*it);
+			if (index < size - 1)
+			{
+				*it = std::move(STD::back());
+			}
+			STD::pop_back();
+			return result;
+		}
+		/// @brief Removes first occurrence of element by moving the last element into its place.
+		/// @param[in] element Element to remove.
+		/// @note This changes the order of elements, but unlike remove it doesn't have to move all following elements.
+		inline void removeUnordered(const T& element)
+		{
+			iterator_t it = this->_find(element);
+			if (it == STD::end())
+			{
+				throw ContainerElementNotFoundException();
+			}
+			iterator_t last = STD::end();
+			--last;
+			if (it != last)
+			{
+				*it = std::move(*last);
+			}
+			STD::pop_back();
+		}
+		/// @brief Removes all elements that match the condition.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
+		/// @return Number of elements removed.
+		/// @note All remaining elements are moved at most once and keep their order.
+		template <typename C>
+		inline int removeIf(C conditionFunction)
+		{
+			int size = this->size();
+			STD::erase(std::remove_if(STD::begin(), STD::end(), conditionFunction), STD::end());
+			return (size - this->size());
+		}
 		/// @brief Removes all occurrences of element in Container.
 		/// @param[in] element Element to remove.
 		/// @return Number of elements removed.
 		inline int removeAll(const T& element)
 		{
-			Container<std::vector<int>, int> indices = this->_indicesOf<Container<std::vector<int>, int> >(element);
-			iterator_t it = STD::begin();
-			int size = indices.size();
-			for_iter_r (i, size, 0)
-			{
-				STD::erase(this->_itAdvance(it, indices.at(i)));
-			}
-			return size;
+			int size = this->size();
+			this->differentiate(element);
+			return (size - this->size());
 		}
 		/// @brief Removes all occurrences of each element in another Container from this one.
 		/// @param[in] other Container of elements to remove.
 		/// @return Number of elements removed.
 		inline int removeAll(const Container& other)
 		{
-			Container<std::vector<int>, int> indices;
-			iterator_t it;
-			int indicesSize = 0;
-			int count = 0;
-			for_iter (i, 0, other.size()) // has to stay other.size() here
-			{
-				indices = this->_indicesOf<Container<std::vector<int>, int> >(other.at(i));
-				it = STD::begin();
-				indicesSize = indices.size();
-				for_iter_r (j, indicesSize, 0)
-				{
-					STD::erase(this->_itAdvance(it, indices.at(j)));
-				}
-				count += indicesSize;
-			}
-			return count;
+			int size = this->size();
+			this->differentiate(other);
+			return (size - this->size());
 		}
 		/// @brief Finds minimum element in Container.
 		/// @return Minimum Element.
@@ -697,10 +804,11 @@ namespace hltypes
 			return (*std::min_element(STD::begin(), STD::end()));
 		}
 		/// @brief Finds minimum element in Container.
-		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
 		/// @return Minimum Element.
 		/// @note compareFunction should return true if first element is less than second element.
-		inline T min(bool (*compareFunction)(T const&, T const&)) const
+		template <typename C>
+		inline T min(C compareFunction) const
 		{
 			if (this->size() == 0)
 			{
@@ -719,10 +827,11 @@ namespace hltypes
 			return (*std::max_element(STD::begin(), STD::end()));
 		}
 		/// @brief Finds maximum element in Container.
-		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
 		/// @return Maximum Element.
 		/// @note compareFunction should return true if first element is greater than second element.
-		inline T max(bool (*compareFunction)(T const&, T const&)) const
+		template <typename C>
+		inline T max(C compareFunction) const
 		{
 			if (this->size() == 0)
 			{
@@ -739,22 +848,15 @@ namespace hltypes
 			{
 				throw ContainerEmptyException("random()");
 			}
-			return this->at(size > 1 ? hrand(size) : 0);
+			return (*this->_itAdvance(STD::begin(), size > 1 ? hrand(size) : 0));
 		}
 		/// @brief Randomizes order of elements in Container.
 		/// @note Not using std::random_shuffle() due to issues with std::srand() in some implementations.
-		/// @note This implementation is done in-place in order to avoid creating another object.
 		inline void randomize()
 		{
-			int size = this->size();
-			if (size > 1)
+			if (this->size() > 1)
 			{
-				this->add(*this);
-				for_iter (i, 0, size - 1)
-				{
-					this->at(i) = this->removeAt(size + hrand(size - i));
-				}
-				this->at(size - 1) = this->removeAt(size);
+				this->_randomize(typename std::iterator_traits<iterator_t>::iterator_category());
 			}
 		}
 		/// @brief Reverses order of elements.
@@ -766,20 +868,11 @@ namespace hltypes
 			}
 		}
 		/// @brief Removes duplicates in Container.
+		/// @note The first occurrence of each element is kept and the order of elements is preserved.
+		/// @note Uses a hash set if hltypes::Hash is enabled for T, otherwise it falls back to only using operator==.
 		inline void removeDuplicates()
 		{
-			Container<std::vector<int>, int> indices;
-			iterator_t it = STD::begin();
-			int indicesSize = 0;
-			for_iter (i, 0, this->size()) // has to stay this->size() here
-			{
-				indices = this->_indicesOf<Container<std::vector<int>, int> >(this->at(i));
-				indicesSize = indices.size();
-				for_iter_r (j, indicesSize, 1)
-				{
-					STD::erase(this->_itAdvance(it, indices.at(j)));
-				}
-			}
+			this->_removeDuplicates(HashEnabled<Hash<T>::Enabled>());
 		}
 		/// @brief Sorts elements in Container.
 		/// @note The sorting order is ascending.
@@ -787,18 +880,19 @@ namespace hltypes
 		{
 			if (this->size() > 0)
 			{
-				std::stable_sort(STD::begin(), STD::end());
+				this->_sort(typename std::iterator_traits<iterator_t>::iterator_category());
 			}
 		}
 		/// @brief Sorts elements in Container.
-		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
 		/// @note The sorting order is ascending.
 		/// @note compareFunction should return true if first element is less than the second element.
-		inline void sort(bool (*compareFunction)(T const&, T const&))
+		template <typename C>
+		inline void sort(C compareFunction)
 		{
 			if (this->size() > 0)
 			{
-				std::stable_sort(STD::begin(), STD::end(), compareFunction);
+				this->_sort(compareFunction, typename std::iterator_traits<iterator_t>::iterator_category());
 			}
 		}
 		/// @brief Unites elements of this Container with an element.
@@ -820,18 +914,13 @@ namespace hltypes
 		/// @brief Intersects elements of this Container with another one.
 		/// @param[in] other Container to intersect with.
 		/// @note Does not remove duplicates.
+		/// @note Uses a hash set if hltypes::Hash is enabled for T, otherwise it falls back to only using operator==.
 		inline void intersect(const Container& other)
 		{
-			Container result;
-			int size = this->size();
-			for_iter (i, 0, size)
+			if (this != &other)
 			{
-				if (other.has(this->at(i)))
-				{
-					result.add(this->at(i));
-				}
+				this->_intersect(other, HashEnabled<Hash<T>::Enabled>());
 			}
-			STD::assign(result.begin(), result.end());
 		}
 		/// @brief Differentiates elements of this Container with an element.
 		/// @param[in] element Element to differentiate with.
@@ -839,37 +928,21 @@ namespace hltypes
 		/// @note Does not remove duplicates.
 		inline void differentiate(const T& element)
 		{
-			int index = 0;
-			while (true)
-			{
-				index = this->indexOf(element);
-				if (index < 0)
-				{
-					break;
-				}
-				STD::erase(this->_itAdvance(STD::begin(), index));
-			}
+			STD::erase(std::remove(STD::begin(), STD::end(), element), STD::end());
 		}
 		/// @brief Differentiates elements of this Container with another one.
 		/// @param[in] other Container to differentiate with.
 		/// @note Unlike remove, this method ignores elements of other Container that are not in this one.
 		/// @note Does not remove duplicates.
+		/// @note Uses a hash set if hltypes::Hash is enabled for T, otherwise it falls back to only using operator==.
 		inline void differentiate(const Container& other)
 		{
-			int index = 0;
-			int size = other.size();
-			for_iter (i, 0, size)
+			if (this == &other)
 			{
-				while (true)
-				{
-					index = this->indexOf(other.at(i));
-					if (index < 0)
-					{
-						break;
-					}
-					STD::erase(this->_itAdvance(STD::begin(), index));
-				}
+				STD::clear();
+				return;
 			}
+			this->_differentiate(other, HashEnabled<Hash<T>::Enabled>());
 		}
 		/// @brief Joins all elements into a string.
 		/// @param[in] separator Separator string between elements.
@@ -878,56 +951,61 @@ namespace hltypes
 		inline String joined(const String& separator) const
 		{
 			String result;
-			int size = this->size();
-			if (size > 0)
+			const_iterator_t it = STD::begin();
+			const_iterator_t end = STD::end();
+			if (it != end)
 			{
-				result += String(this->at(0));
-				for_iter (i, 1, size)
+				result += String(*it);
+				for (++it; it != end; ++it)
 				{
-					result += separator + String(this->at(i));
+					result += separator;
+					result += String(*it);
 				}
 			}
 			return result;
 		}
 		/// @brief Finds and returns first occurrence of element that matches the condition.
-		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
 		/// @return Pointer to element that matches the condition or NULL if no element was found.
-		inline T* findFirst(bool(*conditionFunction)(T const&))
+		template <typename C>
+		inline T* findFirst(C conditionFunction)
 		{
-			int size = this->size();
-			for_iter (i, 0, size)
+			iterator_t end = STD::end();
+			for (iterator_t it = STD::begin(); it != end; ++it)
 			{
-				if (conditionFunction(this->at(i)))
+				if (conditionFunction(*it))
 				{
-					return &this->at(i);
+					return &(*it);
 				}
 			}
 			return NULL;
 		}
 		/// @brief Finds and returns first occurrence of element that matches the condition.
-		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
 		/// @return Pointer to element that matches the condition or NULL if no element was found.
-		inline const T* findFirst(bool (*conditionFunction)(T const&)) const
+		template <typename C>
+		inline const T* findFirst(C conditionFunction) const
 		{
-			int size = this->size();
-			for_iter (i, 0, size)
+			const_iterator_t end = STD::end();
+			for (const_iterator_t it = STD::begin(); it != end; ++it)
 			{
-				if (conditionFunction(this->at(i)))
+				if (conditionFunction(*it))
 				{
-					return &this->at(i);
+					return &(*it);
 				}
 			}
 			return NULL;
 		}
 		/// @brief Checks if at least one element matches the condition.
-		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
 		/// @return True if at least one element matches the condition.
-		inline bool matchesAny(bool (*conditionFunction)(T const&)) const
+		template <typename C>
+		inline bool matchesAny(C conditionFunction) const
 		{
-			int size = this->size();
-			for_iter (i, 0, size)
+			const_iterator_t end = STD::end();
+			for (const_iterator_t it = STD::begin(); it != end; ++it)
 			{
-				if (conditionFunction(this->at(i)))
+				if (conditionFunction(*it))
 				{
 					return true;
 				}
@@ -935,14 +1013,15 @@ namespace hltypes
 			return false;
 		}
 		/// @brief Checks if all elements match the condition.
-		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
 		/// @return True if all elements match the condition.
-		inline bool matchesAll(bool (*conditionFunction)(T const&)) const
+		template <typename C>
+		inline bool matchesAll(C conditionFunction) const
 		{
-			int size = this->size();
-			for_iter (i, 0, size)
+			const_iterator_t end = STD::end();
+			for (const_iterator_t it = STD::begin(); it != end; ++it)
 			{
-				if (!conditionFunction(this->at(i)))
+				if (!conditionFunction(*it))
 				{
 					return false;
 				}
@@ -950,17 +1029,25 @@ namespace hltypes
 			return true;
 		}
 		/// @brief Modifies each element with a special function.
-		/// @param[in] processFunction Function pointer with processing function for the elements.
-		inline void each(void (*processFunction)(T const&))
+		/// @param[in] processFunction Processing function or function object that takes one element of type T.
+		template <typename F>
+		inline void each(F processFunction)
 		{
-			int size = this->size();
-			for_iter (i, 0, size)
+			iterator_t end = STD::end();
+			for (iterator_t it = STD::begin(); it != end; ++it)
 			{
-				processFunction(this->at(i));
+				processFunction(*it);
 			}
 		}
 
 	protected:
+		/// @brief Preallocates space for elements.
+		/// @param[in] count Number of elements.
+		/// @note Only available if STD supports reserve().
+		inline void _reserve(int count)
+		{
+			STD::reserve(count);
+		}
 		/// @brief Gets all indices.
 		/// @return All indices.
 		template <typename R>
@@ -981,12 +1068,13 @@ namespace hltypes
 		inline R _indicesOf(const T& element) const
 		{
 			R result;
-			int size = this->size();
-			for_iter (i, 0, size)
+			int index = 0;
+			const_iterator_t end = STD::end();
+			for (const_iterator_t it = STD::begin(); it != end; ++it, ++index)
 			{
-				if (element == this->at(i))
+				if (element == (*it))
 				{
-					result.add(i);
+					result.add(index);
 				}
 			}
 			return result;
@@ -1097,9 +1185,10 @@ namespace hltypes
 			int size = this->size();
 			if (!unique)
 			{
+				const_iterator_t begin = STD::begin();
 				for_iter (i, 0, count)
 				{
-					result.add(this->at(hrand(size)));
+					result.add(*this->_itAdvance(begin, hrand(size)));
 				}
 			}
 			else if (count > 0)
@@ -1112,14 +1201,18 @@ namespace hltypes
 				{
 					return this->_randomized<R>();
 				}
-				Container<std::vector<int>, int> indices;
-				for_iter (i, 0, size)
+				// partial Fisher-Yates shuffle over iterators so each element is accessed only once
+				std::vector<const_iterator_t> iterators;
+				iterators.reserve(size);
+				const_iterator_t end = STD::end();
+				for (const_iterator_t it = STD::begin(); it != end; ++it)
 				{
-					indices.add(i);
+					iterators.push_back(it);
 				}
 				for_iter (i, 0, count)
 				{
-					result.add(this->at(indices.removeRandom()));
+					std::swap(iterators[i], iterators[i + hrand(size - i)]);
+					result.add(*iterators[i]);
 				}
 			}
 			return result;
@@ -1153,12 +1246,12 @@ namespace hltypes
 			return result;
 		}
 		/// @brief Creates new sorted Container.
-		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
 		/// @return A new Container.
 		/// @note The sorting order is ascending.
 		/// @note compareFunction should return true if first element is less than the second element.
-		template <typename R>
-		inline R _sorted(bool (*compareFunction)(T const&, T const&)) const
+		template <typename R, typename C>
+		inline R _sorted(C compareFunction) const
 		{
 			R result(*this);
 			result.sort(compareFunction);
@@ -1231,33 +1324,33 @@ namespace hltypes
 			return result;
 		}
 		/// @brief Creates new Container with new elements obtained from the current Container elements.
-		/// @param[in] generateFunction Function pointer with generation function for the new elements.
+		/// @param[in] generateFunction Generation function or function object for the new elements.
 		/// @return A new Container with the new elements.
 		/// @note generateFunction should return the element that should be mapped from the original.
-		template <typename R, typename S>
-		inline R _mapped(S (*generateFunction)(T const&)) const
+		template <typename R, typename S, typename F>
+		inline R _mapped(F generateFunction) const
 		{
 			R result;
-			int size = this->size();
-			for_iter (i, 0, size)
+			const_iterator_t end = STD::end();
+			for (const_iterator_t it = STD::begin(); it != end; ++it)
 			{
-				result.add(generateFunction(this->at(i)));
+				result.add(generateFunction(*it));
 			}
 			return result;
 		}
 		/// @brief Finds and returns new Container of elements that match the condition.
-		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
 		/// @return New Container with all matching elements.
-		template <typename R>
-		inline R _findAll(bool (*conditionFunction)(T const&)) const
+		template <typename R, typename C>
+		inline R _findAll(C conditionFunction) const
 		{
 			R result;
-			int size = this->size();
-			for_iter (i, 0, size)
+			const_iterator_t end = STD::end();
+			for (const_iterator_t it = STD::begin(); it != end; ++it)
 			{
-				if (conditionFunction(this->at(i)))
+				if (conditionFunction(*it))
 				{
-					result.add(this->at(i));
+					result.add(*it);
 				}
 			}
 			return result;
@@ -1269,10 +1362,10 @@ namespace hltypes
 		inline R _cast() const
 		{
 			R result;
-			int size = this->size();
-			for_iter (i, 0, size)
+			const_iterator_t end = STD::end();
+			for (const_iterator_t it = STD::begin(); it != end; ++it)
 			{
-				result.add((S)this->at(i));
+				result.add((S)(*it));
 			}
 			return result;
 		}
@@ -1285,11 +1378,11 @@ namespace hltypes
 		{
 			R result;
 			S value;
-			int size = this->size();
-			for_iter (i, 0, size)
+			const_iterator_t end = STD::end();
+			for (const_iterator_t it = STD::begin(); it != end; ++it)
 			{
 				// when seeing "dynamic_cast", I always think of fireballs
-				value = dynamic_cast<S>(this->at(i));
+				value = dynamic_cast<S>(*it);
 				if (value != NULL || includeNulls)
 				{
 					result.add(value);
@@ -1319,6 +1412,217 @@ namespace hltypes
 			std::advance(it, count);
 			return it;
 		}
+		/// @brief Finds the first occurrence of an element.
+		/// @param[in] element Element to search for.
+		/// @return Iterator of the element or end() if it was not found.
+		inline iterator_t _find(const T& element)
+		{
+			iterator_t end = STD::end();
+			for (iterator_t it = STD::begin(); it != end; ++it)
+			{
+				if (element == (*it))
+				{
+					return it;
+				}
+			}
+			return end;
+		}
+		/// @brief Finds the first occurrence of an element.
+		/// @param[in] element Element to search for.
+		/// @return Const iterator of the element or end() if it was not found.
+		inline const_iterator_t _find(const T& element) const
+		{
+			const_iterator_t end = STD::end();
+			for (const_iterator_t it = STD::begin(); it != end; ++it)
+			{
+				if (element == (*it))
+				{
+					return it;
+				}
+			}
+			return end;
+		}
+		/// @brief Sorts elements in-place with random-access iterators.
+		inline void _sort(std::random_access_iterator_tag)
+		{
+			std::stable_sort(STD::begin(), STD::end());
+		}
+		/// @brief Sorts elements with the container's own stable sort if it doesn't have random-access iterators.
+		inline void _sort(std::bidirectional_iterator_tag)
+		{
+			STD::sort();
+		}
+		/// @brief Sorts elements in-place with random-access iterators.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
+		template <typename C>
+		inline void _sort(C compareFunction, std::random_access_iterator_tag)
+		{
+			std::stable_sort(STD::begin(), STD::end(), compareFunction);
+		}
+		/// @brief Sorts elements with the container's own stable sort if it doesn't have random-access iterators.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
+		template <typename C>
+		inline void _sort(C compareFunction, std::bidirectional_iterator_tag)
+		{
+			STD::sort(compareFunction);
+		}
+		/// @brief Randomizes order of elements in-place with a Fisher-Yates shuffle.
+		inline void _randomize(std::random_access_iterator_tag)
+		{
+			iterator_t begin = STD::begin();
+			for_iter_r (i, this->size(), 1)
+			{
+				std::swap(begin[i], begin[hrand(i + 1)]);
+			}
+		}
+		/// @brief Randomizes order of elements if the container doesn't have random-access iterators.
+		/// @note The elements are shuffled in a temporary std::vector and then copied back.
+		inline void _randomize(std::bidirectional_iterator_tag)
+		{
+			std::vector<T> elements(std::make_move_iterator(STD::begin()), std::make_move_iterator(STD::end()));
+			for_iter_r (i, (int)elements.size(), 1)
+			{
+				std::swap(elements[i], elements[hrand(i + 1)]);
+			}
+			std::move(elements.begin(), elements.end(), STD::begin());
+		}
+		/// @brief Hash functor for pointers to elements.
+		/// @note This is used so hash sets can reference elements instead of copying them.
+		struct _PointerHash
+		{
+			inline size_t operator()(const T* value) const
+			{
+				return Hash<T>()(*value);
+			}
+		};
+		/// @brief Equality functor for pointers to elements.
+		/// @note This is used so hash sets can reference elements instead of copying them.
+		struct _PointerEqual
+		{
+			inline bool operator()(const T* a, const T* b) const
+			{
+				return (*a == *b);
+			}
+		};
+		/// @brief Hash set of pointers to elements.
+		typedef std::unordered_set<const T*, _PointerHash, _PointerEqual> _PointerSet;
+		/// @brief Creates a hash set that references all elements.
+		/// @return Hash set of pointers to elements.
+		inline _PointerSet _makePointerSet() const
+		{
+			_PointerSet result;
+			result.reserve(STD::size());
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
+			{
+				result.insert(&(*it));
+			}
+			return result;
+		}
+		/// @brief Removes duplicates in O(n) using a hash set.
+		inline void _removeDuplicates(const HashEnabled<true>& hashEnabled)
+		{
+			_PointerSet found;
+			found.reserve(STD::size());
+			iterator_t end = STD::end();
+			iterator_t last = STD::begin();
+			for (iterator_t it = STD::begin(); it != end; ++it)
+			{
+				if (found.find(&(*it)) == found.end())
+				{
+					if (last != it)
+					{
+						*last = std::move(*it);
+					}
+					// elements before "last" are not overwritten anymore so they can be safely referenced
+					found.insert(&(*last));
+					++last;
+				}
+			}
+			STD::erase(last, end);
+		}
+		/// @brief Removes duplicates using only operator==.
+		inline void _removeDuplicates(const HashEnabled<false>& hashEnabled)
+		{
+			iterator_t end = STD::end();
+			iterator_t begin = STD::begin();
+			iterator_t last = begin;
+			for (iterator_t it = begin; it != end; ++it)
+			{
+				if (std::find(begin, last, *it) == last)
+				{
+					if (last != it)
+					{
+						*last = std::move(*it);
+					}
+					++last;
+				}
+			}
+			STD::erase(last, end);
+		}
+		/// @brief Intersects elements of this Container with another one in O(n + m) using a hash set.
+		/// @param[in] other Container to intersect with.
+		inline void _intersect(const Container& other, const HashEnabled<true>& hashEnabled)
+		{
+			this->_retain(other._makePointerSet(), true);
+		}
+		/// @brief Intersects elements of this Container with another one using only operator==.
+		/// @param[in] other Container to intersect with.
+		inline void _intersect(const Container& other, const HashEnabled<false>& hashEnabled)
+		{
+			this->_retain(other, true);
+		}
+		/// @brief Differentiates elements of this Container with another one in O(n + m) using a hash set.
+		/// @param[in] other Container to differentiate with.
+		inline void _differentiate(const Container& other, const HashEnabled<true>& hashEnabled)
+		{
+			this->_retain(other._makePointerSet(), false);
+		}
+		/// @brief Differentiates elements of this Container with another one using only operator==.
+		/// @param[in] other Container to differentiate with.
+		inline void _differentiate(const Container& other, const HashEnabled<false>& hashEnabled)
+		{
+			this->_retain(other, false);
+		}
+		/// @brief Keeps only elements depending on whether they are contained in a set in a single pass.
+		/// @param[in] set Hash set of pointers to elements.
+		/// @param[in] contained Whether elements that are contained in set should be kept or elements that are not contained in set.
+		inline void _retain(const _PointerSet& set, bool contained)
+		{
+			iterator_t end = STD::end();
+			iterator_t last = STD::begin();
+			for (iterator_t it = STD::begin(); it != end; ++it)
+			{
+				if ((set.find(&(*it)) != set.end()) == contained)
+				{
+					if (last != it)
+					{
+						*last = std::move(*it);
+					}
+					++last;
+				}
+			}
+			STD::erase(last, end);
+		}
+		/// @brief Keeps only elements depending on whether they are contained in another Container in a single pass.
+		/// @param[in] other Other Container.
+		/// @param[in] contained Whether elements that are contained in other should be kept or elements that are not contained in other.
+		inline void _retain(const Container& other, bool contained)
+		{
+			iterator_t end = STD::end();
+			iterator_t last = STD::begin();
+			for (iterator_t it = STD::begin(); it != end; ++it)
+			{
+				if (other.has(*it) == contained)
+				{
+					if (last != it)
+					{
+						*last = std::move(*it);
+					}
+					++last;
+				}
+			}
+			STD::erase(last, end);
+		}
 
 	};
 
@@ -14,6 +14,7 @@
 #define HLTYPES_DEQUE_H
 
 #include <deque>
+#include <utility>
 
 #include "hcontainer.h"
 #include "hexception.h"
@@ -177,38 +178,79 @@ namespace hltypes
 		}
 		/// @brief Creates new Deque with reversed order of elements.
 		/// @return A new Deque.
-		inline Deque<T> reversed() const
+		inline Deque<T> reversed() const&
 		{
 			return this->template _reversed<Deque<T> >();
 		}
+		/// @brief Same as reversed(), but modifies this temporary Deque in-place instead of copying it.
+		/// @return This Deque moved into the result.
+		inline Deque<T> reversed() &&
+		{
+			this->reverse();
+			return std::move(*this);
+		}
 		/// @brief Creates new Deque without duplicates.
 		/// @return A new Deque.
-		inline Deque<T> removedDuplicates() const
+		inline Deque<T> removedDuplicates() const&
 		{
 			return this->template _removedDuplicates<Deque<T> >();
 		}
+		/// @brief Same as removedDuplicates(), but modifies this temporary Deque in-place instead of copying it.
+		/// @return This Deque moved into the result.
+		inline Deque<T> removedDuplicates() &&
+		{
+			this->removeDuplicates();
+			return std::move(*this);
+		}
 		/// @brief Creates new sorted Deque.
 		/// @return A new Deque.
 		/// @note The sorting order is ascending.
-		inline Deque<T> sorted() const
+		inline Deque<T> sorted() const&
 		{
 			return this->template _sorted<Deque<T> >();
 		}
+		/// @brief Same as sorted(), but sorts this temporary Deque in-place instead of copying it.
+		/// @return This Deque moved into the result.
+		/// @note The sorting order is ascending.
+		inline Deque<T> sorted() &&
+		{
+			this->sort();
+			return std::move(*this);
+		}
 		/// @brief Creates new sorted Deque.
-		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
 		/// @return A new Deque.
 		/// @note The sorting order is ascending.
 		/// @note compareFunction should return true if first element is less than the second element.
-		inline Deque<T> sorted(bool (*compareFunction)(T const&, T const&)) const
+		template <typename C>
+		inline Deque<T> sorted(C compareFunction) const&
 		{
 			return this->template _sorted<Deque<T> >(compareFunction);
 		}
+		/// @brief Same as sorted(compareFunction), but sorts this temporary Deque in-place instead of copying it.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
+		/// @return This Deque moved into the result.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		template <typename C>
+		inline Deque<T> sorted(C compareFunction) &&
+		{
+			this->sort(compareFunction);
+			return std::move(*this);
+		}
 		/// @brief Creates a new Deque with randomized order of elements.
 		/// @return A new Deque.
-		inline Deque<T> randomized() const
+		inline Deque<T> randomized() const&
 		{
 			return this->template _randomized<Deque<T> >();
 		}
+		/// @brief Same as randomized(), but modifies this temporary Deque in-place instead of copying it.
+		/// @return This Deque moved into the result.
+		inline Deque<T> randomized() &&
+		{
+			this->randomize();
+			return std::move(*this);
+		}
 		/// @brief Creates a new Deque as union of this Deque with an element.
 		/// @param[in] element Element to unite with.
 		/// @return A new Deque.
@@ -259,10 +301,21 @@ namespace hltypes
 		{
 			return this->template _mapped<Deque<S>, S>(generateFunction);
 		}
+		/// @brief Creates new Deque with new elements obtained from the current Deque elements.
+		/// @param[in] generateFunction Generation function or function object for the new elements.
+		/// @return A new Deque with the new elements.
+		/// @note The type of the new elements is the return type of generateFunction.
+		template <typename F>
+		inline auto mapped(F generateFunction) const -> Deque<typename std::decay<decltype(generateFunction(std::declval<const T&>()))>::type>
+		{
+			typedef typename std::decay<decltype(generateFunction(std::declval<const T&>()))>::type S;
+			return this->template _mapped<Deque<S>, S>(generateFunction);
+		}
 		/// @brief Finds and returns new Deque of elements that match the condition.
-		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
 		/// @return New Deque with all matching elements.
-		inline Deque<T> findAll(bool (*conditionFunction)(T const&)) const
+		template <typename C>
+		inline Deque<T> findAll(C conditionFunction) const
 		{
 			return this->template _findAll<Deque<T> >(conditionFunction);
 		}
@@ -327,6 +380,13 @@ namespace hltypes
 			return (*this);
 		}
 		/// @brief Same as add.
+		/// @see add(T&& element)
+		inline Deque<T>& operator<<(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
 		/// @see add(const Deque<T>& other)
 		inline Deque<T>& operator<<(const Deque<T>& other)
 		{
@@ -341,6 +401,13 @@ namespace hltypes
 			return (*this);
 		}
 		/// @brief Same as add.
+		/// @see add(T&& element)
+		inline Deque<T>& operator+=(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
 		/// @see add(const Deque<T>& other)
 		inline Deque<T>& operator+=(const Deque<T>& other)
 		{
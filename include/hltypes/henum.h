@@ -14,6 +14,7 @@
 #define HLTYPES_ENUMERATION_H
 
 #include "harray.h"
+#include "hbimap.h"
 #include "hltypesUtil.h"
 #include "hltypesExport.h"
 #include "hmap.h"
@@ -31,15 +32,15 @@ public: \
 	inline classe(chstr name, unsigned int value) : henum(value) { this->_addNewInstance(#classe, name, value); } \
 	inline classe next() const \
 	{ \
-		harray<classe> values = classe::getValues(); \
-		values.sort(); \
-		return values[(values.indexOf(*this) + 1) % values.size()]; \
+		const hmap<unsigned int, hstr>& values = _instances.getForward(); \
+		hmap<unsigned int, hstr>::const_iterator_t it = values.upper_bound(this->value); \
+		return classe(it != values.end() ? it->first : values.begin()->first); \
 	} \
 	inline classe previous() const \
 	{ \
-		harray<classe> values = classe::getValues(); \
-		values.sort(); \
-		return values[(values.indexOf(*this) + values.size() - 1) % values.size()]; \
+		const hmap<unsigned int, hstr>& values = _instances.getForward(); \
+		hmap<unsigned int, hstr>::const_iterator_t it = values.lower_bound(this->value); \
+		return classe(it != values.begin() ? (--it)->first : values.rbegin()->first); \
 	} \
 	inline bool operator<(const classe& other) const { return (this->value < other.value); } \
 	inline bool operator>(const classe& other) const { return (this->value > other.value); } \
@@ -54,14 +55,14 @@ public: \
 	inline static harray<classe> getValues() \
 	{ \
 		harray<classe> result; \
-		foreach_map (unsigned int, hstr, it, _instances) \
+		foreachc_map (unsigned int, hstr, it, _instances.getForward()) \
 		{ \
-			result += classe::fromUint(it->first); \
+			result += classe(it->first); \
 		} \
 		return result; \
 	} \
 	inline static hstr getEnumName() { return #classe; } \
-	inline static hmap<unsigned int, hstr> getAsMap() { return _instances; } \
+	inline static hmap<unsigned int, hstr> getAsMap() { return _instances.getForward(); } \
 	inline static classe fromInt(int value) \
 	{ \
 		return fromUint((unsigned int)value); \
@@ -80,7 +81,9 @@ public: \
 	} \
 	inline static classe fromName(chstr name) \
 	{ \
-		if (!_instances.hasValue(name)) \
+		const hmap<hstr, unsigned int>& names = _instances.getReverse(); \
+		hmap<hstr, unsigned int>::const_iterator_t it = names.find(name); \
+		if (it == names.end()) \
 		{ \
 			if (!_useDefaultLooseValue) \
 			{ \
@@ -88,7 +91,7 @@ public: \
 			} \
 			return classe(_defaultLooseValue); \
 		} \
-		return classe(_instances(name)); \
+		return classe(it->second); \
 	} \
 	inline static bool hasValue(chstr name) \
 	{ \
@@ -105,9 +108,9 @@ public: \
 	__HL_EXPAND_MACRO code \
 protected: \
 	inline classe(unsigned int value) : henum(value) { } \
-	inline hmap<unsigned int, hstr>& _getInstances() const { return _instances; } \
+	inline hbimap<unsigned int, hstr>& _getInstances() const { return _instances; } \
 private: \
-	static hmap<unsigned int, hstr> _instances; \
+	static hbimap<unsigned int, hstr> _instances; \
 	static bool _useDefaultLooseValue; \
 	static unsigned int _defaultLooseValue; \
 };
@@ -117,7 +120,7 @@ private: \
 /// @param[in] classe Name of the enum class.
 /// @param[in] code Additional code to process (usually value definitions).
 #define HL_ENUM_CLASS_DEFINE(classe, code) \
-	hmap<unsigned int, hstr> classe::_instances; \
+	hbimap<unsigned int, hstr> classe::_instances; \
 	bool classe::_useDefaultLooseValue = false; \
 	unsigned int classe::_defaultLooseValue = 0; \
 	__HL_EXPAND_MACRO code;
@@ -128,7 +131,7 @@ private: \
 /// @see fromInt()
 /// @see fromUint()
 #define HL_ENUM_CLASS_DEFINE_LOOSE(classe, defaultLooseValue, code) \
-	hmap<unsigned int, hstr> classe::_instances; \
+	hbimap<unsigned int, hstr> classe::_instances; \
 	bool classe::_useDefaultLooseValue = true; \
 	unsigned int classe::_defaultLooseValue = defaultLooseValue; \
 	__HL_EXPAND_MACRO code;
@@ -207,9 +210,10 @@ namespace hltypes
 		/// @note This will NOT auto-generate a value in the internal index. It is used to convert ints to Enumeration instances.
 		Enumeration(unsigned int value);
 
-		/// @brief Gets the Map of Enumeration instances that can exist.
-		/// @return The Map of Enumeration instances that can exist.
-		virtual Map<unsigned int, String>& _getInstances() const { static Map<unsigned int, String> dummy; return dummy; };
+		/// @brief Gets the BiMap of Enumeration instances that can exist.
+		/// @return The BiMap of Enumeration instances that can exist.
+		/// @note Names are indexed as well so lookups by name don't have to search all instances.
+		virtual BiMap<unsigned int, String>& _getInstances() const { static BiMap<unsigned int, String> dummy; return dummy; };
 		/// @brief Adds a new possible instance to the list.
 		/// @param[in] className Name of the Enumeration.
 		/// @param[in] name Name of the Enumeration value.
@@ -219,6 +223,7 @@ namespace hltypes
 		/// @param[in] className Name of the Enumeration.
 		/// @param[in] name Name of the Enumeration value.
 		/// @param[in] value Value to add to the list.
+		/// @note Throws EnumerationValueAlreadyExistsException if value is already used and EnumerationNameAlreadyExistsException if name is already used.
 		void _addNewInstance(const String& className, const String& name, unsigned int value);
 
 	};
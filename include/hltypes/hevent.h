@@ -0,0 +1,82 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides functionality of an event for multithreading.
+
+#ifndef HLTYPES_EVENT_H
+#define HLTYPES_EVENT_H
+
+#include "hconditionvariable.h"
+#include "hltypesExport.h"
+#include "hmutex.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief Provides functionality of an event that threads can wait for.
+	/// @note A manual-reset Event stays set and releases all waiting threads until it is reset. An auto-reset Event releases only one waiting thread and is reset by it.
+	class hltypesExport Event
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @param[in] autoReset Whether the Event is reset automatically when a waiting thread is released.
+		/// @param[in] name The internal name.
+		Event(bool autoReset = false, const String& name = "");
+		/// @brief Destructor.
+		~Event();
+
+		/// @brief Returns the event name.
+		/// @return The event name.
+		inline String getName() const { return this->name; }
+		/// @brief Checks whether the Event is reset automatically.
+		/// @return True if the Event is reset automatically.
+		inline bool isAutoReset() const { return this->autoReset; }
+
+		/// @brief Checks whether the Event is set.
+		/// @return True if the Event is set.
+		bool isSet();
+		/// @brief Sets the Event and releases waiting threads.
+		void set();
+		/// @brief Resets the Event.
+		void reset();
+		/// @brief Waits until the Event is set.
+		void wait();
+		/// @brief Waits until the Event is set or the timeout ran out.
+		/// @param[in] timeout Maximum time to wait in milliseconds.
+		/// @return True if the Event was set, false if the timeout ran out.
+		bool wait(float timeout);
+
+	protected:
+		/// @brief Event name.
+		String name;
+		/// @brief Whether the Event is reset automatically.
+		bool autoReset;
+		/// @brief Whether the Event is set.
+		bool state;
+		/// @brief Mutex for the state.
+		Mutex mutex;
+		/// @brief Condition variable that waiting threads block on.
+		ConditionVariable condition;
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		Event(const Event& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		Event& operator=(Event& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::Event hevent;
+
+#endif
@@ -13,9 +13,13 @@
 #ifndef HLTYPES_EXCEPTION_H
 #define HLTYPES_EXCEPTION_H
 
+#include "hatomic.h"
 #include "hltypesExport.h"
 #include "hstring.h"
 
+/// @brief Maximum number of stack frames that are captured for an exception.
+#define HL_EXCEPTION_STACK_FRAMES 62
+
 /// @brief Declares an exception class.
 /// @param[in] exportDefinition Export definition.
 /// @param[in] classe Name of the exception class.
@@ -90,18 +94,37 @@ namespace hltypes
 		virtual inline String getRawMessage() const { return this->rawMessage; }
 		/// @brief Gets the stack trace.
 		/// @return The stack trace.
-		inline String getStackTrace() const { return this->stackTrace; }
+		/// @note The symbols of the captured stack frames are only resolved on the first call so throwing stays cheap.
+		/// @note Thread-safe, the same exception can be inspected from several threads (e.g. through ThreadPool::Future).
+		String getStackTrace() const;
 		/// @brief Gets the full error message with stack trace.
 		/// @return The full error message with stack trace.
-		inline String getFullMessage() const { return this->message + "\n" + this->stackTrace; }
+		inline String getFullMessage() const { return this->message + "\n" + this->getStackTrace(); }
+
+		/// @brief Sets whether stack frames are captured when an exception is created.
+		/// @param[in] value New value.
+		/// @note Not implemented as inline, because optimizer strips it away even if compiled as DLL.
+		static void setStackTraceEnabled(bool value);
+		/// @brief Checks whether stack frames are captured when an exception is created.
+		/// @return True if stack frames are captured when an exception is created.
+		static bool isStackTraceEnabled();
 
 	protected:
 		/// @brief Exception message.
 		String message;
 		/// @brief Exception raw message, without source file and line number.
 		String rawMessage;
-		/// @brief Stack trace.
-		String stackTrace;
+		/// @brief Stack trace, resolved from stackFrames on first use.
+		/// @note Only accessed while the resolving mutex in getStackTrace() is locked.
+		mutable String stackTrace;
+		/// @brief Whether stackTrace has already been resolved.
+		mutable bool stackTraceResolved;
+		/// @brief Captured return addresses of the stack.
+		void* stackFrames[HL_EXCEPTION_STACK_FRAMES];
+		/// @brief Number of captured stack frames.
+		int stackFrameCount;
+		/// @brief Whether stack frames are captured when an exception is created.
+		static Atomic<bool> stackTraceEnabled;
 		/// @brief Sets internal message.
 		/// @param[in] message Exception message.
 		/// @param[in] sourceFile Name of the source file.
@@ -359,6 +382,23 @@ namespace hltypes
 	/// @brief Alias for simpler code.
 	#define EnumerationValueAlreadyExistsException(value) hltypes::_EnumerationValueAlreadyExistsException(value, __FILE__, __LINE__)
 
+	/// @brief Defines a enumeration-name-already-exists exception.
+	class hltypesExport _EnumerationNameAlreadyExistsException : public _Exception
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @param[in] name Enumeration name.
+		/// @param[in] sourceFile Name of the source file.
+		/// @param[in] lineNumber Number of the line.
+		_EnumerationNameAlreadyExistsException(const String& name, const char* sourceFile, int lineNumber);
+		/// @brief Gets the exception type.
+		/// @return The exception type.
+		inline String getType() const { return "EnumerationNameAlreadyExistsException"; }
+
+	};
+	/// @brief Alias for simpler code.
+	#define EnumerationNameAlreadyExistsException(name) hltypes::_EnumerationNameAlreadyExistsException(name, __FILE__, __LINE__)
+
 }
 
 /// @brief Alias for simpler code.
@@ -17,6 +17,7 @@
 #include <stdio.h>
 
 #include "henum.h"
+#include "hatomic.h"
 #include "hsbase.h"
 #include "hstring.h"
 
@@ -110,6 +111,11 @@ namespace hltypes
 		String filename;
 		/// @brief OS file handle.
 		void* cfile;
+		/// @brief Additional OS file handle with its own file pointer for positional reads and writes.
+		/// @note It's opened on the first positional access and only on platforms where positional access would move the file pointer of cfile.
+		Atomic<void*> positionalHandle;
+		/// @brief Whether the file was opened with an access mode that allows writing.
+		bool writable;
 
 		/// @brief Gets special descriptor.
 		/// @return Special descriptor.
@@ -134,6 +140,26 @@ namespace hltypes
 		/// @param[in] count Number of elements contained in buffer.
 		/// @return Number of bytes written.
 		int _fwrite(const void* buffer, int count);
+		/// @brief Gets the OS file handle for positional reads and writes and opens it on first use.
+		/// @return The OS file handle or NULL if the platform doesn't need one.
+		void* _getPositionalHandle();
+		/// @brief Reads data from a position in the file without using the file's stream position.
+		/// @param[in] offset Position in the file in bytes.
+		/// @param[in] buffer Destination data buffer.
+		/// @param[in] count Number of bytes to read.
+		/// @return Number of bytes read.
+		/// @note Data that was written, but is still buffered, will not be read.
+		int _freadAt(int64_t offset, void* buffer, int count);
+		/// @brief Writes data to a position in the file without using the file's stream position.
+		/// @param[in] offset Position in the file in bytes.
+		/// @param[in] buffer Source data buffer.
+		/// @param[in] count Number of bytes contained in buffer.
+		/// @return Number of bytes written.
+		/// @note Data that was already buffered for reading from the stream is not updated.
+		int _fwriteAt(int64_t offset, const void* buffer, int count);
+		/// @brief Sets the data size to a new value if it's larger than the current one.
+		/// @param[in] size The new data size.
+		void _growDataSize(int64_t size);
 		/// @brief Checks if file is open.
 		/// @return True if file is open.
 		virtual bool _fisOpen() const;
@@ -17,6 +17,7 @@
 
 #include "hfbase.h"
 #include "hstring.h"
+#include "hthreadpool.h"
 
 #include "hltypesExport.h"
 
@@ -43,6 +44,49 @@ namespace hltypes
 		/// @brief Closes file.
 		void close();
 		
+		/// @brief Reads data from a position in the file.
+		/// @param[in] offset Position in the file in bytes.
+		/// @param[in] buffer Destination data buffer.
+		/// @param[in] count Number of bytes to read.
+		/// @return Number of bytes read.
+		/// @note The stream position is neither used nor changed so several threads can call this on the same File at the same time.
+		/// @note Data that was written with write(), but is still buffered, will not be read.
+		int readAt(int64_t offset, void* buffer, int count);
+		/// @brief Writes data to a position in the file.
+		/// @param[in] offset Position in the file in bytes.
+		/// @param[in] buffer Source data buffer.
+		/// @param[in] count Number of bytes contained in buffer.
+		/// @return Number of bytes written.
+		/// @note The stream position is neither used nor changed so several threads can call this on the same File at the same time.
+		/// @note Data that was already buffered by read() is not updated. In append modes some platforms ignore offset and append the data.
+		int writeAt(int64_t offset, const void* buffer, int count);
+		/// @brief Reads data from a position in the file asynchronously.
+		/// @param[in] offset Position in the file in bytes.
+		/// @param[in] buffer Destination data buffer.
+		/// @param[in] count Number of bytes to read.
+		/// @return Future of the read that returns the number of bytes read.
+		/// @note The file must stay open and the buffer must stay valid until the read has finished.
+		/// @see readAt(int64_t offset, void* buffer, int count)
+		ThreadPool::Future<int> readAsync(int64_t offset, void* buffer, int count);
+		/// @brief Reads data from a position in the file asynchronously and calls a function when it has finished.
+		/// @param[in] offset Position in the file in bytes.
+		/// @param[in] buffer Destination data buffer.
+		/// @param[in] count Number of bytes to read.
+		/// @param[in] callback Function or function object that takes the number of bytes read as int.
+		/// @return Future of the read and the callback.
+		/// @note The callback is called from an I/O thread.
+		/// @see readAsync(int64_t offset, void* buffer, int count)
+		template <typename F>
+		inline ThreadPool::Future<void> readAsync(int64_t offset, void* buffer, int count, F callback)
+		{
+			this->_validate();
+			File* file = this;
+			return File::_getAsyncPool()->submit([file, offset, buffer, count, callback]()
+			{
+				callback(file->_freadAt(offset, buffer, count));
+			});
+		}
+
 		/// @brief Creates a file.
 		/// @param[in] filename Name of the file.
 		/// @return True if a new file was created. False if file could not be created or already exists.
@@ -125,6 +169,11 @@ namespace hltypes
 		/// @param[in] seekMode Seeking mode.
 		bool _seek(int64_t offset, SeekMode seekMode = SeekMode::Current);
 
+		/// @brief Gets the pool that executes asynchronous reads.
+		/// @return The pool that executes asynchronous reads.
+		/// @note The pool is created on first use. It has more workers than there are hardware threads, because they mostly wait for the disk.
+		static ThreadPool* _getAsyncPool();
+
 	private:
 		/// @brief Copy constructor.
 		/// @note Usage is not allowed and it will throw an exception.
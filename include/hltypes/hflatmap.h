@@ -0,0 +1,994 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides a map stored as a sorted array and adds high level methods.
+
+#ifndef HLTYPES_FLAT_MAP_H
+#define HLTYPES_FLAT_MAP_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "harray.h"
+#include "hexception.h"
+#include "hltypesUtil.h"
+#include "hmap.h"
+#include "hstring.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#define __foreach_this_flat_map_it(name) for (const_iterator_t name = this->begin(), name ## End = this->end(); name != name ## End; ++name)
+#endif
+
+namespace hltypes
+{
+	/// @brief Map stored as one contiguous array of entries sorted by key that provides the same high level methods as Map.
+	/// @note Lookups are binary searches over contiguous memory so they don't have to follow pointers between allocated nodes.
+	/// @note Inserting and removing single entries has to move all following entries. FlatMap is meant for tables that are built once and then mostly read.
+	/// @note Any insertion or removal invalidates iterators and references to entries. K needs operator< just like with Map.
+	template <typename K, typename V>
+	class FlatMap
+	{
+	public:
+		/// @brief Type of an entry.
+		/// @note The key of an entry must not be modified through an iterator.
+		typedef std::pair<K, V> entry_t;
+		/// @brief Iterator type exposure.
+		typedef typename std::vector<entry_t>::iterator iterator_t;
+		/// @brief Iterator type exposure.
+		typedef typename std::vector<entry_t>::const_iterator const_iterator_t;
+		/// @brief Iterator type exposure.
+		typedef typename std::vector<K>::iterator kiterator_t;
+		/// @brief Iterator type exposure.
+		typedef typename std::vector<K>::const_iterator const_kiterator_t;
+
+		/// @brief Empty constructor.
+		inline FlatMap()
+		{
+		}
+		/// @brief Copy constructor.
+		/// @param[in] other FlatMap to copy.
+		inline FlatMap(const FlatMap& other) : entries(other.entries)
+		{
+		}
+		/// @brief Move constructor.
+		/// @param[in] other FlatMap to move.
+		inline FlatMap(FlatMap&& other) noexcept : entries(std::move(other.entries))
+		{
+		}
+		/// @brief Constructor from a Map.
+		/// @param[in] other Map to copy.
+		/// @note Since Map is already ordered by key, this doesn't need to sort.
+		inline FlatMap(const Map<K, V>& other)
+		{
+			this->entries.reserve(other.size());
+			for (typename Map<K, V>::const_iterator_t it = other.begin(), itEnd = other.end(); it != itEnd; ++it)
+			{
+				this->entries.push_back(entry_t(it->first, it->second));
+			}
+		}
+		/// @brief Constructor from an Array of key-value pairs.
+		/// @param[in] other Array of key-value pairs.
+		/// @note If a key appears multiple times, the last pair with that key is used.
+		inline FlatMap(const Array<std::pair<K, V> >& other)
+		{
+			this->entries.reserve(other.size());
+			for (typename Array<std::pair<K, V> >::const_iterator_t it = other.begin(), itEnd = other.end(); it != itEnd; ++it)
+			{
+				this->entries.push_back(*it);
+			}
+			this->_sortEntries();
+		}
+		/// @brief Assignment operator.
+		/// @param[in] other FlatMap to copy.
+		/// @return This FlatMap.
+		inline FlatMap& operator=(const FlatMap& other)
+		{
+			this->entries = other.entries;
+			return (*this);
+		}
+		/// @brief Move assignment operator.
+		/// @param[in] other FlatMap to move.
+		/// @return This FlatMap.
+		inline FlatMap& operator=(FlatMap&& other) noexcept
+		{
+			this->entries = std::move(other.entries);
+			return (*this);
+		}
+		/// @brief Gets the iterator at the beginning, entries are ordered by key.
+		/// @return The iterator object.
+		inline iterator_t begin()
+		{
+			return this->entries.begin();
+		}
+		/// @brief Gets the iterator at the beginning, entries are ordered by key.
+		/// @return The iterator object.
+		inline const_iterator_t begin() const
+		{
+			return this->entries.begin();
+		}
+		/// @brief Gets the iterator at the end.
+		/// @return The iterator object.
+		inline iterator_t end()
+		{
+			return this->entries.end();
+		}
+		/// @brief Gets the iterator at the end.
+		/// @return The iterator object.
+		inline const_iterator_t end() const
+		{
+			return this->entries.end();
+		}
+		/// @brief Finds the entry of a key.
+		/// @param[in] key Key to search for.
+		/// @return Iterator of the entry or end() if key is not present.
+		inline iterator_t find(const K& key)
+		{
+			int index = this->_find(key);
+			return (index >= 0 ? this->entries.begin() + index : this->entries.end());
+		}
+		/// @brief Finds the entry of a key.
+		/// @param[in] key Key to search for.
+		/// @return Const iterator of the entry or end() if key is not present.
+		inline const_iterator_t find(const K& key) const
+		{
+			int index = this->_find(key);
+			return (index >= 0 ? this->entries.begin() + index : this->entries.end());
+		}
+		/// @brief Finds the first entry with a key that is not less than the given key.
+		/// @param[in] key Key to search for.
+		/// @return Const iterator of the entry or end() if all keys are less than key.
+		inline const_iterator_t lowerBound(const K& key) const
+		{
+			return this->entries.begin() + this->_lowerBound(key);
+		}
+		/// @brief Finds the first entry with a key that is greater than the given key.
+		/// @param[in] key Key to search for.
+		/// @return Const iterator of the entry or end() if no key is greater than key.
+		inline const_iterator_t upperBound(const K& key) const
+		{
+			int index = this->_lowerBound(key);
+			if (index < (int)this->entries.size() && !(key < this->entries[index].first))
+			{
+				++index;
+			}
+			return this->entries.begin() + index;
+		}
+		/// @brief Returns value with specified key.
+		/// @param[in] key Key of the value.
+		/// @return Value with specified key.
+		/// @note If key is not present, it is inserted with a default constructed value.
+		inline V& operator[](const K& key)
+		{
+			int index = this->_lowerBound(key);
+			if (index >= (int)this->entries.size() || key < this->entries[index].first)
+			{
+				this->entries.insert(this->entries.begin() + index, entry_t(key, V()));
+			}
+			return this->entries[index].second;
+		}
+		/// @brief Same as keyOf.
+		/// @see keyOf
+		inline K operator()(const V& value) const
+		{
+			return this->keyOf(value);
+		}
+		/// @brief Same as equals.
+		/// @see equals
+		inline bool operator==(const FlatMap& other) const
+		{
+			return this->equals(other);
+		}
+		/// @brief Same as nequals.
+		/// @see nequals
+		inline bool operator!=(const FlatMap& other) const
+		{
+			return this->nequals(other);
+		}
+		/// @brief Returns the number of values in the FlatMap.
+		/// @return The number of values in the FlatMap.
+		inline int size() const
+		{
+			return (int)this->entries.size();
+		}
+		/// @brief Check if FlatMap is empty.
+		/// @return True if FlatMap is empty.
+		inline bool isEmpty() const
+		{
+			return this->entries.empty();
+		}
+		/// @brief Gets the number of entries that can be stored without reallocating.
+		/// @return Number of entries that can be stored without reallocating.
+		inline int getCapacity() const
+		{
+			return (int)this->entries.capacity();
+		}
+		/// @brief Removes all entries.
+		inline void clear()
+		{
+			this->entries.clear();
+		}
+		/// @brief Makes sure that a number of entries can be stored without reallocating.
+		/// @param[in] size Number of entries.
+		inline void reserve(int size)
+		{
+			this->entries.reserve(size);
+		}
+		/// @brief Releases memory that isn't needed for the current entries.
+		/// @note Useful after a table has been built.
+		inline void compact()
+		{
+			std::vector<entry_t>(this->entries).swap(this->entries);
+		}
+		/// @brief Returns an Array with all keys ordered by key.
+		/// @return An Array with all keys.
+		inline Array<K> keys() const
+		{
+			Array<K> result;
+			__foreach_this_flat_map_it(it)
+			{
+				result += it->first;
+			}
+			return result;
+		}
+		/// @brief Returns an Array with all values ordered by key.
+		/// @return An Array with all values.
+		inline Array<V> values() const
+		{
+			Array<V> result;
+			__foreach_this_flat_map_it(it)
+			{
+				result += it->second;
+			}
+			return result;
+		}
+		/// @brief Returns an Array with all values in the same order as the given corresponding keys.
+		/// @return An Array with all values in the same order as the given corresponding keys.
+		inline Array<V> values(const Array<K>& keys) const
+		{
+			Array<V> result;
+			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it)
+			{
+				result += this->valueOf(*it);
+			}
+			return result;
+		}
+		/// @brief Returns an Array with all key-value pairs ordered by key.
+		/// @return An Array with all key-value pairs.
+		inline Array<std::pair<K, V> > keyValuePairs() const
+		{
+			Array<std::pair<K, V> > result;
+			__foreach_this_flat_map_it(it)
+			{
+				result += (*it);
+			}
+			return result;
+		}
+		/// @brief Returns an Array with all key-value pairs in the same order as the given corresponding keys.
+		/// @return An Array with all key-value pairs in the same order as the given corresponding keys.
+		inline Array<std::pair<K, V> > keyValuePairs(const Array<K>& keys) const
+		{
+			Array<std::pair<K, V> > result;
+			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it)
+			{
+				result += std::pair<K, V>((*it), this->valueOf(*it));
+			}
+			return result;
+		}
+		/// @brief Compares the contents of two FlatMaps for being equal.
+		/// @param[in] other Another FlatMap.
+		/// @return True if number of keys and values are equal and all pairs of keys and values are equal.
+		inline bool equals(const FlatMap& other) const
+		{
+			if (this->size() != other.size())
+			{
+				return false;
+			}
+			for (const_iterator_t it = this->begin(), it2 = other.begin(), itEnd = this->end(); it != itEnd; ++it, ++it2)
+			{
+				// making sure operator== is used, not !=
+				if (!(it->first == it2->first) || !(it->second == it2->second))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Compares the contents of two FlatMaps for being not equal.
+		/// @param[in] other Another FlatMap.
+		/// @return True if number of keys and values are not equal or at least one pair of keys and values is not equal.
+		inline bool nequals(const FlatMap& other) const
+		{
+			if (this->size() != other.size())
+			{
+				return true;
+			}
+			for (const_iterator_t it = this->begin(), it2 = other.begin(), itEnd = this->end(); it != itEnd; ++it, ++it2)
+			{
+				// making sure operator!= is used, not ==
+				if (it->first != it2->first || it->second != it2->second)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Returns key of specified value.
+		/// @param[in] value Value with the given key.
+		/// @return Key of specified value.
+		inline K keyOf(const V& value) const
+		{
+			__foreach_this_flat_map_it(it)
+			{
+				if (it->second == value)
+				{
+					return it->first;
+				}
+			}
+			throw ContainerElementNotFoundException();
+		}
+		/// @brief Returns value of specified key.
+		/// @param[in] key Key of the given value.
+		/// @return Value of specified key.
+		inline V valueOf(const K& key) const
+		{
+			int index = this->_find(key);
+			if (index < 0)
+			{
+				throw ContainerElementNotFoundException();
+			}
+			return this->entries[index].second;
+		}
+		/// @brief Checks for existence of a key.
+		/// @param[in] key Key to check.
+		/// @return True if key is present.
+		inline bool hasKey(const K& key) const
+		{
+			return (this->_find(key) >= 0);
+		}
+		/// @brief Checks for existence of a key within an Array of keys.
+		/// @param[in] keys Array of keys to check.
+		/// @return True if any key is present.
+		inline bool hasAnyKey(const Array<K>& keys) const
+		{
+			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it)
+			{
+				if (this->hasKey(*it))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Checks for existence of a key within an Array of keys.
+		/// @param[in] keys C-type array of keys to check.
+		/// @param[in] count Number of keys to check.
+		/// @return True if any key is present.
+		inline bool hasAnyKey(const K keys[], const int count) const
+		{
+			for_iter (i, 0, count)
+			{
+				if (this->hasKey(keys[i]))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Checks for existence of all keys.
+		/// @param[in] keys Array of keys to check.
+		/// @return True if all keys are present.
+		inline bool hasAllKeys(const Array<K>& keys) const
+		{
+			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it)
+			{
+				if (!this->hasKey(*it))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Checks for existence of all keys.
+		/// @param[in] keys C-type array of keys to check.
+		/// @param[in] count Number of keys to check.
+		/// @return True if all keys are present.
+		inline bool hasAllKeys(const K keys[], const int count) const
+		{
+			for_iter (i, 0, count)
+			{
+				if (!this->hasKey(keys[i]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Checks for existence of a value.
+		/// @param[in] value Value to check.
+		/// @return True if value is present.
+		inline bool hasValue(const V& value) const
+		{
+			__foreach_this_flat_map_it(it)
+			{
+				if (it->second == value)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Checks for existence of a values in an Array of values.
+		/// @param[in] values Array of values to check.
+		/// @return True if any values are present.
+		inline bool hasAnyValue(const Array<V>& values) const
+		{
+			for (typename Array<V>::const_iterator_t it = values.begin(), itEnd = values.end(); it != itEnd; ++it)
+			{
+				if (this->hasValue(*it))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Checks for existence of a values in an Array of values.
+		/// @param[in] values C-type array of values to check.
+		/// @param[in] count Number of values to check.
+		/// @return True if any values are present.
+		inline bool hasAnyValue(const V values[], const int count) const
+		{
+			for_iter (i, 0, count)
+			{
+				if (this->hasValue(values[i]))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Checks for existence of all values.
+		/// @param[in] values Array of values to check.
+		/// @return True if all values are present.
+		inline bool hasAllValues(const Array<V>& values) const
+		{
+			for (typename Array<V>::const_iterator_t it = values.begin(), itEnd = values.end(); it != itEnd; ++it)
+			{
+				if (!this->hasValue(*it))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Checks for existence of all values.
+		/// @param[in] values C-type array of values to check.
+		/// @param[in] count Number of values to check.
+		/// @return True if all values are present.
+		inline bool hasAllValues(const V values[], const int count) const
+		{
+			for_iter (i, 0, count)
+			{
+				if (!this->hasValue(values[i]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Adds a new pair of key and value into the FlatMap.
+		/// @param[in] key Key of the entry.
+		/// @param[in] value Value of the entry.
+		/// @note If the key is already present, its value is overwritten.
+		inline void insert(const K& key, const V& value)
+		{
+			int index = this->_lowerBound(key);
+			if (index < (int)this->entries.size() && !(key < this->entries[index].first))
+			{
+				this->entries[index].second = value;
+			}
+			else
+			{
+				this->entries.insert(this->entries.begin() + index, entry_t(key, value));
+			}
+		}
+		/// @brief Adds a new pair of key and value into the FlatMap by moving them.
+		/// @param[in] key Key of the entry.
+		/// @param[in] value Value of the entry.
+		/// @note If the key is already present, its value is overwritten.
+		inline void insert(K&& key, V&& value)
+		{
+			int index = this->_lowerBound(key);
+			if (index < (int)this->entries.size() && !(key < this->entries[index].first))
+			{
+				this->entries[index].second = std::move(value);
+			}
+			else
+			{
+				this->entries.insert(this->entries.begin() + index, entry_t(std::move(key), std::move(value)));
+			}
+		}
+		/// @brief Adds a new pair of key and value into the FlatMap by moving the value.
+		/// @param[in] key Key of the entry.
+		/// @param[in] value Value of the entry.
+		/// @note If the key is already present, its value is overwritten.
+		inline void insert(const K& key, V&& value)
+		{
+			int index = this->_lowerBound(key);
+			if (index < (int)this->entries.size() && !(key < this->entries[index].first))
+			{
+				this->entries[index].second = std::move(value);
+			}
+			else
+			{
+				this->entries.insert(this->entries.begin() + index, entry_t(key, std::move(value)));
+			}
+		}
+		/// @brief Adds all pairs of keys and values from another FlatMap into this one.
+		/// @param[in] other Another FlatMap.
+		/// @note Entries with already existing keys will not be overwritten.
+		/// @note Both FlatMaps are merged in one linear pass.
+		inline void insert(const FlatMap& other)
+		{
+			if (this != &other)
+			{
+				this->_merge(other, false);
+			}
+		}
+		/// @brief Adds all pairs of keys and values from another FlatMap into this one.
+		/// @param[in] other Another FlatMap.
+		/// @note Entries with already existing keys will be overwritten. In comparison to insert, this function is doing a barrel roll.
+		/// @note Both FlatMaps are merged in one linear pass.
+		inline void inject(const FlatMap& other)
+		{
+			if (this != &other)
+			{
+				this->_merge(other, true);
+			}
+		}
+		/// @brief Removes a pair of key and value specified by a key.
+		/// @param[in] key Key of the entry.
+		/// @return True if key was present and removed.
+		inline bool removeKey(const K& key)
+		{
+			int index = this->_find(key);
+			if (index < 0)
+			{
+				return false;
+			}
+			this->entries.erase(this->entries.begin() + index);
+			return true;
+		}
+		/// @brief Removes all pairs of key and value specified by an Array of keys.
+		/// @param[in] keys Array of keys.
+		/// @return How many keys were removed.
+		inline int removeKeys(const Array<K>& keys)
+		{
+			int result = 0;
+			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it)
+			{
+				if (this->removeKey(*it))
+				{
+					++result;
+				}
+			}
+			return result;
+		}
+		/// @brief Removes a pair of key and value specified by a value.
+		/// @param[in] value Value of the entry.
+		/// @return True if value was present and removed.
+		inline bool removeValue(const V& value)
+		{
+			for (iterator_t it = this->entries.begin(); it != this->entries.end(); ++it)
+			{
+				if (it->second == value)
+				{
+					this->entries.erase(it);
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Removes all pairs of key and value specified by an Array of values.
+		/// @param[in] values Array of values.
+		/// @return How many values were removed.
+		/// @note Only the first found entry is removed for each value.
+		inline int removeValues(const Array<V>& values)
+		{
+			int result = 0;
+			for (typename Array<V>::const_iterator_t it = values.begin(), itEnd = values.end(); it != itEnd; ++it)
+			{
+				if (this->removeValue(*it))
+				{
+					++result;
+				}
+			}
+			return result;
+		}
+		/// @brief Gets a random element in FlatMap.
+		/// @param[out] value Value of selected random entry.
+		/// @return Random element.
+		inline K random(V* value = NULL) const
+		{
+			if (this->entries.size() == 0)
+			{
+				throw ContainerEmptyException("random()");
+			}
+			const entry_t& entry = this->entries[hrand(this->size())];
+			if (value != NULL)
+			{
+				*value = entry.second;
+			}
+			return entry.first;
+		}
+		/// @brief Gets a FlatMap of random elements selected from this one.
+		/// @param[in] count Number of random elements.
+		/// @return FlatMap of random elements selected from this one.
+		/// @note The entries keep their order so the result doesn't need to be sorted.
+		inline FlatMap random(int count) const
+		{
+			if (count >= this->size())
+			{
+				return FlatMap(*this);
+			}
+			FlatMap result;
+			if (count > 0)
+			{
+				std::vector<bool> selected = this->_selectRandom(count);
+				result.entries.reserve(count);
+				for_iter (i, 0, (int)selected.size())
+				{
+					if (selected[i])
+					{
+						result.entries.push_back(this->entries[i]);
+					}
+				}
+			}
+			return result;
+		}
+		/// @brief Gets a random element in FlatMap and removes it.
+		/// @param[out] value Value of selected random entry.
+		/// @return Random element.
+		inline K removeRandom(V* value = NULL)
+		{
+			if (this->entries.size() == 0)
+			{
+				throw ContainerEmptyException("removeRandom()");
+			}
+			iterator_t it = this->entries.begin() + hrand(this->size());
+			K key = std::move(it->first);
+			if (value != NULL)
+			{
+				*value = std::move(it->second);
+			}
+			this->entries.erase(it);
+			return key;
+		}
+		/// @brief Gets a FlatMap of random elements selected from this one and removes them.
+		/// @param[in] count Number of random elements.
+		/// @return FlatMap of random elements selected from this one.
+		inline FlatMap removeRandom(int count)
+		{
+			FlatMap result;
+			if (count >= this->size())
+			{
+				result = std::move(*this);
+				return result;
+			}
+			if (count > 0)
+			{
+				std::vector<bool> selected = this->_selectRandom(count);
+				std::vector<entry_t> remaining;
+				remaining.reserve(this->entries.size() - count);
+				result.entries.reserve(count);
+				for_iter (i, 0, (int)selected.size())
+				{
+					if (selected[i])
+					{
+						result.entries.push_back(std::move(this->entries[i]));
+					}
+					else
+					{
+						remaining.push_back(std::move(this->entries[i]));
+					}
+				}
+				this->entries.swap(remaining);
+			}
+			return result;
+		}
+		/// @brief Finds and returns new FlatMap with entries that match the condition.
+		/// @param[in] conditionFunction Condition function or function object that takes a key of type K and a value of type V and returns bool.
+		/// @return New FlatMap with all matching elements.
+		template <typename C>
+		inline FlatMap findAll(C conditionFunction) const
+		{
+			FlatMap result;
+			__foreach_this_flat_map_it(it)
+			{
+				if (conditionFunction(it->first, it->second))
+				{
+					result.entries.push_back(*it);
+				}
+			}
+			return result;
+		}
+		/// @brief Checks if at least one entry matches the condition.
+		/// @param[in] conditionFunction Condition function or function object that takes a key of type K and a value of type V and returns bool.
+		/// @return True if at least one entry matches the condition.
+		template <typename C>
+		inline bool matchesAny(C conditionFunction) const
+		{
+			__foreach_this_flat_map_it(it)
+			{
+				if (conditionFunction(it->first, it->second))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Checks if all entries match the condition.
+		/// @param[in] conditionFunction Condition function or function object that takes a key of type K and a value of type V and returns bool.
+		/// @return True if all entries match the condition.
+		template <typename C>
+		inline bool matchesAll(C conditionFunction) const
+		{
+			__foreach_this_flat_map_it(it)
+			{
+				if (!conditionFunction(it->first, it->second))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Returns a new FlatMap with all keys and values cast into the type L and S.
+		/// @return A new FlatMap with all keys and values cast into the type L and S.
+		/// @note Make sure all keys can be cast into type L and all values into type S.
+		template <typename L, typename S>
+		inline FlatMap<L, S> cast() const
+		{
+			FlatMap<L, S> result;
+			result.entries.reserve(this->entries.size());
+			__foreach_this_flat_map_it(it)
+			{
+				result.entries.push_back(std::pair<L, S>((L)it->first, (S)it->second));
+			}
+			result._sortEntries();
+			return result;
+		}
+		/// @brief Returns a new FlatMap with all keys and values dynamically cast into the type L and S.
+		/// @param[in] includeNulls Whether to include value NULLs that failed to cast.
+		/// @return A new FlatMap with all keys and values cast into the type L and S.
+		/// @note Be careful not to use this function with non-pointers and classes that don't have virtual functions.
+		template <typename L, typename S>
+		inline FlatMap<L, S> dynamicCast(bool includeNulls = false) const
+		{
+			FlatMap<L, S> result;
+			L key;
+			S value;
+			__foreach_this_flat_map_it(it)
+			{
+				key = dynamic_cast<L>(it->first);
+				value = dynamic_cast<S>(it->second);
+				if (key != NULL && (value != NULL || includeNulls))
+				{
+					result.entries.push_back(std::pair<L, S>(key, value));
+				}
+			}
+			result._sortEntries();
+			return result;
+		}
+		/// @brief Returns a new FlatMap with all keys and values dynamically cast into the type L and non-dynamically into S.
+		/// @return A new FlatMap with all keys and values cast into the type L and S.
+		/// @note If dynamic casting fails, it won't be included in the result.
+		/// @note Be careful not to use this function with non-pointers and classes that don't have virtual functions.
+		template <typename L, typename S>
+		inline FlatMap<L, S> dynamicCastKeys() const
+		{
+			FlatMap<L, S> result;
+			L key;
+			__foreach_this_flat_map_it(it)
+			{
+				key = dynamic_cast<L>(it->first);
+				if (key != NULL)
+				{
+					result.entries.push_back(std::pair<L, S>(key, (S)it->second));
+				}
+			}
+			result._sortEntries();
+			return result;
+		}
+		/// @brief Returns a new FlatMap with all keys and values cast into the type L and dynamically into S.
+		/// @param[in] includeNulls Whether to include value NULLs that failed to cast.
+		/// @return A new FlatMap with all keys and values cast into the type L and S.
+		/// @note Be careful not to use this function with non-pointers and classes that don't have virtual functions.
+		template <typename L, typename S>
+		inline FlatMap<L, S> dynamicCastValues(bool includeNulls = false) const
+		{
+			FlatMap<L, S> result;
+			S value;
+			__foreach_this_flat_map_it(it)
+			{
+				value = dynamic_cast<S>(it->second);
+				if (value != NULL || includeNulls)
+				{
+					result.entries.push_back(std::pair<L, S>((L)it->first, value));
+				}
+			}
+			result._sortEntries();
+			return result;
+		}
+		/// @brief Finds and returns value stored at key. In case no value is found, returns the given default value.
+		/// @param[in] key Key to retrieve the value of.
+		/// @param[in] defaultValue Default value to return if key does not exist.
+		/// @return Value stored at key or given default value.
+		inline V tryGet(const K& key, const V& defaultValue) const
+		{
+			int index = this->_find(key);
+			return (index >= 0 ? this->entries[index].second : defaultValue);
+		}
+		/// @brief Same as insert.
+		/// @see insert(const FlatMap& other)
+		inline FlatMap& operator+=(const FlatMap& other)
+		{
+			this->insert(other);
+			return (*this);
+		}
+		/// @brief Merges two FlatMaps.
+		/// @param[in] other Second FlatMap to merge with.
+		/// @return New FlatMap with entries of both FlatMaps.
+		/// @note Entries with already existing keys in the first FlatMap will not be overwritten.
+		inline FlatMap operator+(const FlatMap& other) const
+		{
+			FlatMap result(*this);
+			result += other;
+			return result;
+		}
+
+	protected:
+		template <typename L, typename S>
+		friend class FlatMap;
+
+		/// @brief Entries sorted by key.
+		std::vector<entry_t> entries;
+
+		/// @brief Finds the index of the first entry with a key that is not less than the given key.
+		/// @param[in] key Key to search for.
+		/// @return Index of the entry or size() if all keys are less than key.
+		inline int _lowerBound(const K& key) const
+		{
+			int first = 0;
+			int count = (int)this->entries.size();
+			int step = 0;
+			while (count > 0)
+			{
+				step = count / 2;
+				if (this->entries[first + step].first < key)
+				{
+					first += step + 1;
+					count -= step + 1;
+				}
+				else
+				{
+					count = step;
+				}
+			}
+			return first;
+		}
+		/// @brief Finds the index of the entry of a key.
+		/// @param[in] key Key to search for.
+		/// @return Index of the entry or -1 if key is not present.
+		inline int _find(const K& key) const
+		{
+			int index = this->_lowerBound(key);
+			return (index < (int)this->entries.size() && !(key < this->entries[index].first) ? index : -1);
+		}
+		/// @brief Merges the entries of another FlatMap into this one.
+		/// @param[in] other Another FlatMap.
+		/// @param[in] overwrite Whether entries with already existing keys are overwritten.
+		inline void _merge(const FlatMap& other, bool overwrite)
+		{
+			if (other.entries.size() == 0)
+			{
+				return;
+			}
+			std::vector<entry_t> result;
+			result.reserve(this->entries.size() + other.entries.size());
+			iterator_t it = this->entries.begin();
+			iterator_t itEnd = this->entries.end();
+			const_iterator_t it2 = other.entries.begin();
+			const_iterator_t it2End = other.entries.end();
+			while (it != itEnd && it2 != it2End)
+			{
+				if (it->first < it2->first)
+				{
+					result.push_back(std::move(*it));
+					++it;
+				}
+				else if (it2->first < it->first)
+				{
+					result.push_back(*it2);
+					++it2;
+				}
+				else
+				{
+					if (overwrite)
+					{
+						result.push_back(*it2);
+					}
+					else
+					{
+						result.push_back(std::move(*it));
+					}
+					++it;
+					++it2;
+				}
+			}
+			for (; it != itEnd; ++it)
+			{
+				result.push_back(std::move(*it));
+			}
+			result.insert(result.end(), it2, it2End);
+			this->entries.swap(result);
+		}
+		/// @brief Sorts unordered entries by key.
+		/// @note If a key appears multiple times, only the last entry with that key is kept.
+		inline void _sortEntries()
+		{
+			std::stable_sort(this->entries.begin(), this->entries.end(), &FlatMap::_compareKeys);
+			int size = (int)this->entries.size();
+			int count = 0;
+			for_iter (i, 0, size)
+			{
+				if (i + 1 < size && !(this->entries[i].first < this->entries[i + 1].first))
+				{
+					continue;
+				}
+				if (count != i)
+				{
+					this->entries[count] = std::move(this->entries[i]);
+				}
+				++count;
+			}
+			this->entries.erase(this->entries.begin() + count, this->entries.end());
+		}
+		/// @brief Selects random entries.
+		/// @param[in] count Number of entries to select.
+		/// @return Flags for every entry whether it was selected.
+		inline std::vector<bool> _selectRandom(int count) const
+		{
+			std::vector<bool> result(this->entries.size(), false);
+			Array<int> indices;
+			for_iter (i, 0, this->size())
+			{
+				indices += i;
+			}
+			for_iter (i, 0, count)
+			{
+				result[indices.removeAt(hrand(indices.size()))] = true;
+			}
+			return result;
+		}
+
+		/// @brief Compares the keys of two entries.
+		static inline bool _compareKeys(const entry_t& a, const entry_t& b)
+		{
+			return (a.first < b.first);
+		}
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+#define hflatmap hltypes::FlatMap
+
+#endif
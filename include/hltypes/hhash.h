@@ -0,0 +1,117 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides hash functors used by hash-based algorithms and containers.
+
+#ifndef HLTYPES_HASH_H
+#define HLTYPES_HASH_H
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hltypesUtil.h"
+#include "hstring.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#define __HL_HASH_FNV_OFFSET_BASIS 2166136261U
+#define __HL_HASH_FNV_PRIME 16777619U
+#endif
+
+namespace hltypes
+{
+	/// @brief Calculates the FNV-1a hash of raw data.
+	/// @param[in] data Pointer to the data.
+	/// @param[in] size Size of the data in bytes.
+	/// @return The hash value.
+	inline unsigned int hashData(const void* data, int size)
+	{
+		const unsigned char* bytes = (const unsigned char*)data;
+		unsigned int hash = __HL_HASH_FNV_OFFSET_BASIS;
+		for_iter (i, 0, size)
+		{
+			hash = (hash ^ bytes[i]) * __HL_HASH_FNV_PRIME;
+		}
+		return hash;
+	}
+
+	/// @brief Hash functor for element types.
+	/// @note Enabled is false for types without a hash function. Algorithms then fall back to implementations that only use operator==.
+	/// @note Specialize this template with Enabled set to true and an operator() returning size_t to enable hash-based algorithms for custom types.
+	template <typename T>
+	struct Hash
+	{
+		/// @brief Whether hashing is supported for T.
+		static const bool Enabled = false;
+	};
+
+	/// @brief Hash functor for pointers.
+	template <typename T>
+	struct Hash<T*>
+	{
+		/// @brief Whether hashing is supported for T.
+		static const bool Enabled = true;
+		/// @brief Calculates the hash of a value.
+		/// @param[in] value The value.
+		/// @return The hash value.
+		inline size_t operator()(T* const& value) const
+		{
+			return std::hash<T*>()(value);
+		}
+	};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#define __HL_HASH_FROM_STD(type) \
+	template <> \
+	struct Hash<type> : public std::hash<type> \
+	{ \
+		static const bool Enabled = true; \
+	};
+
+	__HL_HASH_FROM_STD(char)
+	__HL_HASH_FROM_STD(unsigned char)
+	__HL_HASH_FROM_STD(short)
+	__HL_HASH_FROM_STD(unsigned short)
+	__HL_HASH_FROM_STD(int)
+	__HL_HASH_FROM_STD(unsigned int)
+	__HL_HASH_FROM_STD(long)
+	__HL_HASH_FROM_STD(unsigned long)
+	__HL_HASH_FROM_STD(long long)
+	__HL_HASH_FROM_STD(unsigned long long)
+	__HL_HASH_FROM_STD(float)
+	__HL_HASH_FROM_STD(double)
+
+#undef __HL_HASH_FROM_STD
+#endif
+
+	/// @brief Hash functor for String.
+	template <>
+	struct Hash<String>
+	{
+		/// @brief Whether hashing is supported for T.
+		static const bool Enabled = true;
+		/// @brief Calculates the hash of a value.
+		/// @param[in] value The value.
+		/// @return The hash value.
+		inline size_t operator()(const String& value) const
+		{
+			return hashData(value.cStr(), value.size());
+		}
+	};
+
+	/// @brief Compile-time flag used to dispatch between hash-based and generic implementations.
+	template <bool Value>
+	struct HashEnabled
+	{
+	};
+
+}
+
+#endif
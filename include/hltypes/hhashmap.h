@@ -0,0 +1,1166 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides a hash map with open addressing and adds high level methods.
+
+#ifndef HLTYPES_HASH_MAP_H
+#define HLTYPES_HASH_MAP_H
+
+#include <iterator>
+#include <new>
+#include <stddef.h>
+#include <stdlib.h>
+#include <utility>
+
+#include "harray.h"
+#include "hexception.h"
+#include "hhash.h"
+#include "hltypesUtil.h"
+#include "hstring.h"
+
+/// @brief Minimum number of slots allocated by a HashMap.
+#define MIN_HASH_MAP_CAPACITY 8
+/// @brief Maximum load factor of a HashMap in percent before it grows.
+#define HASH_MAP_MAX_LOAD_PERCENT 85
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#define __foreach_this_hash_map_it(name) for (const_iterator_t name = this->begin(), name ## End = this->end(); name != name ## End; ++name)
+#define __foreach_other_hash_map_it(name, other) for (const_iterator_t name = other.begin(), name ## End = other.end(); name != name ## End; ++name)
+#endif
+
+namespace hltypes
+{
+	/// @brief Hash map with open addressing and Robin Hood probing that provides the same high level methods as Map.
+	/// @note All entries are stored in one flat table so lookups don't have to follow pointers between allocated nodes.
+	/// @note Iteration order is not defined and any insertion or removal invalidates iterators and references to entries.
+	/// @note K has to be supported by hltypes::Hash or a custom hash functor has to be supplied as H.
+	template <typename K, typename V, typename H = Hash<K> >
+	class HashMap
+	{
+	public:
+		/// @brief Type of an entry.
+		/// @note The key of an entry must not be modified through an iterator.
+		typedef std::pair<K, V> entry_t;
+
+		/// @brief Forward iterator over the entries of a HashMap.
+		template <typename E>
+		class Iterator
+		{
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef E value_type;
+			typedef ptrdiff_t difference_type;
+			typedef E* pointer;
+			typedef E& reference;
+
+			inline Iterator() : entries(NULL), distances(NULL), index(0), capacity(0) { }
+			inline Iterator(E* entries, const unsigned char* distances, int index, int capacity) : entries(entries), distances(distances), index(index), capacity(capacity)
+			{
+				this->_skipEmpty();
+			}
+			/// @brief Allows conversion from a non-const iterator to a const iterator.
+			template <typename F>
+			inline Iterator(const Iterator<F>& other) : entries(other.entries), distances(other.distances), index(other.index), capacity(other.capacity) { }
+
+			inline E& operator*() const { return this->entries[this->index]; }
+			inline E* operator->() const { return &this->entries[this->index]; }
+			inline Iterator& operator++()
+			{
+				++this->index;
+				this->_skipEmpty();
+				return (*this);
+			}
+			inline Iterator operator++(int)
+			{
+				Iterator result(*this);
+				++(*this);
+				return result;
+			}
+			inline bool operator==(const Iterator& other) const { return (this->index == other.index && this->entries == other.entries); }
+			inline bool operator!=(const Iterator& other) const { return (this->index != other.index || this->entries != other.entries); }
+
+		protected:
+			template <typename F>
+			friend class Iterator;
+			friend class HashMap;
+
+			E* entries;
+			const unsigned char* distances;
+			int index;
+			int capacity;
+
+			inline void _skipEmpty()
+			{
+				while (this->index < this->capacity && this->distances[this->index] == 0)
+				{
+					++this->index;
+				}
+			}
+
+		};
+
+		/// @brief Iterator type exposure.
+		typedef Iterator<entry_t> iterator_t;
+		/// @brief Iterator type exposure.
+		typedef Iterator<const entry_t> const_iterator_t;
+		/// @brief Iterator type exposure.
+		typedef typename std::vector<K>::iterator kiterator_t;
+		/// @brief Iterator type exposure.
+		typedef typename std::vector<K>::const_iterator const_kiterator_t;
+
+		/// @brief Empty constructor.
+		inline HashMap() : entries(NULL), hashes(NULL), distances(NULL), capacity(0), count(0)
+		{
+		}
+		/// @brief Copy constructor.
+		/// @param[in] other HashMap to copy.
+		inline HashMap(const HashMap& other) : entries(NULL), hashes(NULL), distances(NULL), capacity(0), count(0)
+		{
+			this->_copy(other);
+		}
+		/// @brief Move constructor.
+		/// @param[in] other HashMap to move.
+		inline HashMap(HashMap&& other) noexcept : entries(other.entries), hashes(other.hashes), distances(other.distances), capacity(other.capacity), count(other.count)
+		{
+			other.entries = NULL;
+			other.hashes = NULL;
+			other.distances = NULL;
+			other.capacity = 0;
+			other.count = 0;
+		}
+		/// @brief Destructor.
+		inline ~HashMap()
+		{
+			this->_destroy();
+		}
+		/// @brief Assignment operator.
+		/// @param[in] other HashMap to copy.
+		/// @return This HashMap.
+		inline HashMap& operator=(const HashMap& other)
+		{
+			if (this != &other)
+			{
+				this->clear();
+				this->_copy(other);
+			}
+			return (*this);
+		}
+		/// @brief Move assignment operator.
+		/// @param[in] other HashMap to move.
+		/// @return This HashMap.
+		inline HashMap& operator=(HashMap&& other) noexcept
+		{
+			if (this != &other)
+			{
+				this->_destroy();
+				this->entries = other.entries;
+				this->hashes = other.hashes;
+				this->distances = other.distances;
+				this->capacity = other.capacity;
+				this->count = other.count;
+				other.entries = NULL;
+				other.hashes = NULL;
+				other.distances = NULL;
+				other.capacity = 0;
+				other.count = 0;
+			}
+			return (*this);
+		}
+		/// @brief Gets the iterator at the beginning.
+		/// @return The iterator object.
+		inline iterator_t begin()
+		{
+			return iterator_t(this->entries, this->distances, 0, this->capacity);
+		}
+		/// @brief Gets the iterator at the beginning.
+		/// @return The iterator object.
+		inline const_iterator_t begin() const
+		{
+			return const_iterator_t(this->entries, this->distances, 0, this->capacity);
+		}
+		/// @brief Gets the iterator at the end.
+		/// @return The iterator object.
+		inline iterator_t end()
+		{
+			return iterator_t(this->entries, this->distances, this->capacity, this->capacity);
+		}
+		/// @brief Gets the iterator at the end.
+		/// @return The iterator object.
+		inline const_iterator_t end() const
+		{
+			return const_iterator_t(this->entries, this->distances, this->capacity, this->capacity);
+		}
+		/// @brief Finds the entry of a key.
+		/// @param[in] key Key to search for.
+		/// @return Iterator of the entry or end() if key is not present.
+		inline iterator_t find(const K& key)
+		{
+			int index = this->_find(key, HashMap::_hash(key));
+			return (index >= 0 ? iterator_t(this->entries, this->distances, index, this->capacity) : this->end());
+		}
+		/// @brief Finds the entry of a key.
+		/// @param[in] key Key to search for.
+		/// @return Const iterator of the entry or end() if key is not present.
+		inline const_iterator_t find(const K& key) const
+		{
+			int index = this->_find(key, HashMap::_hash(key));
+			return (index >= 0 ? const_iterator_t(this->entries, this->distances, index, this->capacity) : this->end());
+		}
+		/// @brief Returns value with specified key.
+		/// @param[in] key Key of the value.
+		/// @return Value with specified key.
+		/// @note If key is not present, it is inserted with a default constructed value.
+		inline V& operator[](const K& key)
+		{
+			size_t hash = HashMap::_hash(key);
+			int index = this->_find(key, hash);
+			if (index < 0)
+			{
+				index = this->_insertNew(entry_t(key, V()), hash);
+			}
+			return this->entries[index].second;
+		}
+		/// @brief Same as keyOf.
+		/// @see keyOf
+		inline K operator()(const V& value) const
+		{
+			return this->keyOf(value);
+		}
+		/// @brief Same as equals.
+		/// @see equals
+		inline bool operator==(const HashMap& other) const
+		{
+			return this->equals(other);
+		}
+		/// @brief Same as nequals.
+		/// @see nequals
+		inline bool operator!=(const HashMap& other) const
+		{
+			return this->nequals(other);
+		}
+		/// @brief Returns the number of values in the HashMap.
+		/// @return The number of values in the HashMap.
+		inline int size() const
+		{
+			return this->count;
+		}
+		/// @brief Check if HashMap is empty.
+		/// @return True if HashMap is empty.
+		inline bool isEmpty() const
+		{
+			return (this->count == 0);
+		}
+		/// @brief Gets the number of slots in the table.
+		/// @return Number of slots in the table.
+		inline int getCapacity() const
+		{
+			return this->capacity;
+		}
+		/// @brief Removes all entries.
+		/// @note This does not release the table.
+		inline void clear()
+		{
+			for_iter (i, 0, this->capacity)
+			{
+				if (this->distances[i] != 0)
+				{
+					this->entries[i].~entry_t();
+					this->distances[i] = 0;
+				}
+			}
+			this->count = 0;
+		}
+		/// @brief Makes sure that a number of entries can be stored without growing the table.
+		/// @param[in] size Number of entries.
+		inline void reserve(int size)
+		{
+			int newCapacity = hmax(this->capacity, MIN_HASH_MAP_CAPACITY);
+			while (size * 100 > newCapacity * HASH_MAP_MAX_LOAD_PERCENT)
+			{
+				newCapacity <<= 1;
+			}
+			if (newCapacity != this->capacity)
+			{
+				this->_rehash(newCapacity);
+			}
+		}
+		/// @brief Returns an Array with all keys.
+		/// @return An Array with all keys.
+		inline Array<K> keys() const
+		{
+			Array<K> result;
+			__foreach_this_hash_map_it(it)
+			{
+				result += it->first;
+			}
+			return result;
+		}
+		/// @brief Returns an Array with all values.
+		/// @return An Array with all values.
+		inline Array<V> values() const
+		{
+			Array<V> result;
+			__foreach_this_hash_map_it(it)
+			{
+				result += it->second;
+			}
+			return result;
+		}
+		/// @brief Returns an Array with all values in the same order as the given corresponding keys.
+		/// @return An Array with all values in the same order as the given corresponding keys.
+		inline Array<V> values(const Array<K>& keys) const
+		{
+			Array<V> result;
+			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it)
+			{
+				result += this->valueOf(*it);
+			}
+			return result;
+		}
+		/// @brief Returns an Array with all key-value pairs.
+		/// @return An Array with all key-value pairs.
+		inline Array<std::pair<K, V> > keyValuePairs() const
+		{
+			Array<std::pair<K, V> > result;
+			__foreach_this_hash_map_it(it)
+			{
+				result += (*it);
+			}
+			return result;
+		}
+		/// @brief Returns an Array with all key-value pairs in the same order as the given corresponding keys.
+		/// @return An Array with all key-value pairs in the same order as the given corresponding keys.
+		inline Array<std::pair<K, V> > keyValuePairs(const Array<K>& keys) const
+		{
+			Array<std::pair<K, V> > result;
+			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it)
+			{
+				result += std::pair<K, V>((*it), this->valueOf(*it));
+			}
+			return result;
+		}
+		/// @brief Compares the contents of two HashMaps for being equal.
+		/// @param[in] other Another HashMap.
+		/// @return True if number of keys and values are equal and all pairs of keys and values are equal.
+		/// @note The order of entries is not relevant.
+		inline bool equals(const HashMap& other) const
+		{
+			if (this->size() != other.size())
+			{
+				return false;
+			}
+			int index = 0;
+			__foreach_this_hash_map_it(it)
+			{
+				index = other._find(it->first, this->hashes[it.index]);
+				// making sure operator== is used, not !=
+				if (index < 0 || !(it->second == other.entries[index].second))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Compares the contents of two HashMaps for being not equal.
+		/// @param[in] other Another HashMap.
+		/// @return True if number of keys and values are not equal or at least one pair of keys and values is not equal.
+		/// @note The order of entries is not relevant.
+		inline bool nequals(const HashMap& other) const
+		{
+			if (this->size() != other.size())
+			{
+				return true;
+			}
+			int index = 0;
+			__foreach_this_hash_map_it(it)
+			{
+				index = other._find(it->first, this->hashes[it.index]);
+				// making sure operator!= is used, not ==
+				if (index < 0 || it->second != other.entries[index].second)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Returns key of specified value.
+		/// @param[in] value Value with the given key.
+		/// @return Key of specified value.
+		inline K keyOf(const V& value) const
+		{
+			__foreach_this_hash_map_it(it)
+			{
+				if (it->second == value)
+				{
+					return it->first;
+				}
+			}
+			throw ContainerElementNotFoundException();
+		}
+		/// @brief Returns value of specified key.
+		/// @param[in] key Key of the given value.
+		/// @return Value of specified key.
+		inline V valueOf(const K& key) const
+		{
+			int index = this->_find(key, HashMap::_hash(key));
+			if (index < 0)
+			{
+				throw ContainerElementNotFoundException();
+			}
+			return this->entries[index].second;
+		}
+		/// @brief Checks for existence of a key.
+		/// @param[in] key Key to check.
+		/// @return True if key is present.
+		inline bool hasKey(const K& key) const
+		{
+			return (this->_find(key, HashMap::_hash(key)) >= 0);
+		}
+		/// @brief Checks for existence of a key within an Array of keys.
+		/// @param[in] keys Array of keys to check.
+		/// @return True if any key is present.
+		inline bool hasAnyKey(const Array<K>& keys) const
+		{
+			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it)
+			{
+				if (this->hasKey(*it))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Checks for existence of a key within an Array of keys.
+		/// @param[in] keys C-type array of keys to check.
+		/// @param[in] count Number of keys to check.
+		/// @return True if any key is present.
+		inline bool hasAnyKey(const K keys[], const int count) const
+		{
+			for_iter (i, 0, count)
+			{
+				if (this->hasKey(keys[i]))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Checks for existence of all keys.
+		/// @param[in] keys Array of keys to check.
+		/// @return True if all keys are present.
+		inline bool hasAllKeys(const Array<K>& keys) const
+		{
+			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it)
+			{
+				if (!this->hasKey(*it))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Checks for existence of all keys.
+		/// @param[in] keys C-type array of keys to check.
+		/// @param[in] count Number of keys to check.
+		/// @return True if all keys are present.
+		inline bool hasAllKeys(const K keys[], const int count) const
+		{
+			for_iter (i, 0, count)
+			{
+				if (!this->hasKey(keys[i]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Checks for existence of a value.
+		/// @param[in] value Value to check.
+		/// @return True if value is present.
+		inline bool hasValue(const V& value) const
+		{
+			__foreach_this_hash_map_it(it)
+			{
+				if (it->second == value)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Checks for existence of a values in an Array of values.
+		/// @param[in] values Array of values to check.
+		/// @return True if any values are present.
+		inline bool hasAnyValue(const Array<V>& values) const
+		{
+			for (typename Array<V>::const_iterator_t it = values.begin(), itEnd = values.end(); it != itEnd; ++it)
+			{
+				if (this->hasValue(*it))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Checks for existence of a values in an Array of values.
+		/// @param[in] values C-type array of values to check.
+		/// @param[in] count Number of values to check.
+		/// @return True if any values are present.
+		inline bool hasAnyValue(const V values[], const int count) const
+		{
+			for_iter (i, 0, count)
+			{
+				if (this->hasValue(values[i]))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Checks for existence of all values.
+		/// @param[in] values Array of values to check.
+		/// @return True if all values are present.
+		inline bool hasAllValues(const Array<V>& values) const
+		{
+			for (typename Array<V>::const_iterator_t it = values.begin(), itEnd = values.end(); it != itEnd; ++it)
+			{
+				if (!this->hasValue(*it))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Checks for existence of all values.
+		/// @param[in] values C-type array of values to check.
+		/// @param[in] count Number of values to check.
+		/// @return True if all values are present.
+		inline bool hasAllValues(const V values[], const int count) const
+		{
+			for_iter (i, 0, count)
+			{
+				if (!this->hasValue(values[i]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Adds a new pair of key and value into the HashMap.
+		/// @param[in] key Key of the entry.
+		/// @param[in] value Value of the entry.
+		/// @note If the key is already present, its value is overwritten.
+		inline void insert(const K& key, const V& value)
+		{
+			size_t hash = HashMap::_hash(key);
+			int index = this->_find(key, hash);
+			if (index >= 0)
+			{
+				this->entries[index].second = value;
+			}
+			else
+			{
+				this->_insertNew(entry_t(key, value), hash);
+			}
+		}
+		/// @brief Adds a new pair of key and value into the HashMap by moving them.
+		/// @param[in] key Key of the entry.
+		/// @param[in] value Value of the entry.
+		/// @note If the key is already present, its value is overwritten.
+		inline void insert(K&& key, V&& value)
+		{
+			size_t hash = HashMap::_hash(key);
+			int index = this->_find(key, hash);
+			if (index >= 0)
+			{
+				this->entries[index].second = std::move(value);
+			}
+			else
+			{
+				this->_insertNew(entry_t(std::move(key), std::move(value)), hash);
+			}
+		}
+		/// @brief Adds a new pair of key and value into the HashMap by moving the value.
+		/// @param[in] key Key of the entry.
+		/// @param[in] value Value of the entry.
+		/// @note If the key is already present, its value is overwritten.
+		inline void insert(const K& key, V&& value)
+		{
+			size_t hash = HashMap::_hash(key);
+			int index = this->_find(key, hash);
+			if (index >= 0)
+			{
+				this->entries[index].second = std::move(value);
+			}
+			else
+			{
+				this->_insertNew(entry_t(key, std::move(value)), hash);
+			}
+		}
+		/// @brief Adds all pairs of keys and values from another HashMap into this one.
+		/// @param[in] other Another HashMap.
+		/// @note Entries with already existing keys will not be overwritten.
+		inline void insert(const HashMap& other)
+		{
+			if (this == &other)
+			{
+				return;
+			}
+			this->reserve(this->count + other.count);
+			size_t hash = 0;
+			__foreach_other_hash_map_it(it, other)
+			{
+				hash = other.hashes[it.index];
+				if (this->_find(it->first, hash) < 0)
+				{
+					this->_insertNew(*it, hash);
+				}
+			}
+		}
+		/// @brief Adds all pairs of keys and values from another HashMap into this one.
+		/// @param[in] other Another HashMap.
+		/// @note Entries with already existing keys will be overwritten. In comparison to insert, this function is doing a barrel roll.
+		inline void inject(const HashMap& other)
+		{
+			if (this == &other)
+			{
+				return;
+			}
+			this->reserve(this->count + other.count);
+			size_t hash = 0;
+			int index = 0;
+			__foreach_other_hash_map_it(it, other)
+			{
+				hash = other.hashes[it.index];
+				index = this->_find(it->first, hash);
+				if (index >= 0)
+				{
+					this->entries[index].second = it->second;
+				}
+				else
+				{
+					this->_insertNew(*it, hash);
+				}
+			}
+		}
+		/// @brief Removes a pair of key and value specified by a key.
+		/// @param[in] key Key of the entry.
+		/// @return True if key was present and removed.
+		inline bool removeKey(const K& key)
+		{
+			int index = this->_find(key, HashMap::_hash(key));
+			if (index < 0)
+			{
+				return false;
+			}
+			this->_erase(index);
+			return true;
+		}
+		/// @brief Removes all pairs of key and value specified by an Array of keys.
+		/// @param[in] keys Array of keys.
+		/// @return How many keys were removed.
+		inline int removeKeys(const Array<K>& keys)
+		{
+			int result = 0;
+			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it)
+			{
+				if (this->removeKey(*it))
+				{
+					++result;
+				}
+			}
+			return result;
+		}
+		/// @brief Removes a pair of key and value specified by a value.
+		/// @param[in] value Value of the entry.
+		/// @return True if value was present and removed.
+		inline bool removeValue(const V& value)
+		{
+			__foreach_this_hash_map_it(it)
+			{
+				if (it->second == value)
+				{
+					this->_erase(it.index);
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Removes all pairs of key and value specified by an Array of values.
+		/// @param[in] values Array of values.
+		/// @return How many values were removed.
+		/// @note Only the first found entry is removed for each value.
+		inline int removeValues(const Array<V>& values)
+		{
+			int result = 0;
+			for (typename Array<V>::const_iterator_t it = values.begin(), itEnd = values.end(); it != itEnd; ++it)
+			{
+				if (this->removeValue(*it))
+				{
+					++result;
+				}
+			}
+			return result;
+		}
+		/// @brief Gets a random element in HashMap.
+		/// @param[out] value Value of selected random entry.
+		/// @return Random element.
+		inline K random(V* value = NULL) const
+		{
+			if (this->count == 0)
+			{
+				throw ContainerEmptyException("random()");
+			}
+			int index = this->_randomIndex();
+			if (value != NULL)
+			{
+				*value = this->entries[index].second;
+			}
+			return this->entries[index].first;
+		}
+		/// @brief Gets a HashMap of random elements selected from this one.
+		/// @param[in] count Number of random elements.
+		/// @return HashMap of random elements selected from this one.
+		inline HashMap random(int count) const
+		{
+			if (count >= this->count)
+			{
+				return HashMap(*this);
+			}
+			HashMap result;
+			if (count > 0)
+			{
+				Array<int> indices;
+				__foreach_this_hash_map_it(it)
+				{
+					indices += it.index;
+				}
+				int index = 0;
+				for_iter (i, 0, count)
+				{
+					index = indices.removeAt(hrand(indices.size()));
+					result._insertNew(this->entries[index], this->hashes[index]);
+				}
+			}
+			return result;
+		}
+		/// @brief Gets a random element in HashMap and removes it.
+		/// @param[out] value Value of selected random entry.
+		/// @return Random element.
+		inline K removeRandom(V* value = NULL)
+		{
+			if (this->count == 0)
+			{
+				throw ContainerEmptyException("removeRandom()");
+			}
+			int index = this->_randomIndex();
+			K key = std::move(this->entries[index].first);
+			if (value != NULL)
+			{
+				*value = std::move(this->entries[index].second);
+			}
+			this->_erase(index);
+			return key;
+		}
+		/// @brief Gets a HashMap of random elements selected from this one and removes them.
+		/// @param[in] count Number of random elements.
+		/// @return HashMap of random elements selected from this one.
+		inline HashMap removeRandom(int count)
+		{
+			HashMap result;
+			if (count >= this->count)
+			{
+				result = std::move(*this);
+				return result;
+			}
+			if (count > 0)
+			{
+				Array<K> keys = this->random(count).keys();
+				for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it)
+				{
+					size_t hash = HashMap::_hash(*it);
+					int index = this->_find(*it, hash);
+					result._insertNew(std::move(this->entries[index]), hash);
+					this->_erase(index);
+				}
+			}
+			return result;
+		}
+		/// @brief Finds and returns new HashMap with entries that match the condition.
+		/// @param[in] conditionFunction Condition function or function object that takes a key of type K and a value of type V and returns bool.
+		/// @return New HashMap with all matching elements.
+		template <typename C>
+		inline HashMap findAll(C conditionFunction) const
+		{
+			HashMap result;
+			__foreach_this_hash_map_it(it)
+			{
+				if (conditionFunction(it->first, it->second))
+				{
+					result._insertNew(*it, this->hashes[it.index]);
+				}
+			}
+			return result;
+		}
+		/// @brief Checks if at least one entry matches the condition.
+		/// @param[in] conditionFunction Condition function or function object that takes a key of type K and a value of type V and returns bool.
+		/// @return True if at least one entry matches the condition.
+		template <typename C>
+		inline bool matchesAny(C conditionFunction) const
+		{
+			__foreach_this_hash_map_it(it)
+			{
+				if (conditionFunction(it->first, it->second))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		/// @brief Checks if all entries match the condition.
+		/// @param[in] conditionFunction Condition function or function object that takes a key of type K and a value of type V and returns bool.
+		/// @return True if all entries match the condition.
+		template <typename C>
+		inline bool matchesAll(C conditionFunction) const
+		{
+			__foreach_this_hash_map_it(it)
+			{
+				if (!conditionFunction(it->first, it->second))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Returns a new HashMap with all keys and values cast into the type L and S.
+		/// @return A new HashMap with all keys and values cast into the type L and S.
+		/// @note Make sure all keys can be cast into type L and all values into type S.
+		template <typename L, typename S>
+		inline HashMap<L, S> cast() const
+		{
+			HashMap<L, S> result;
+			result.reserve(this->count);
+			__foreach_this_hash_map_it(it)
+			{
+				result[(L)it->first] = (S)it->second;
+			}
+			return result;
+		}
+		/// @brief Returns a new HashMap with all keys and values dynamically cast into the type L and S.
+		/// @param[in] includeNulls Whether to include value NULLs that failed to cast.
+		/// @return A new HashMap with all keys and values cast into the type L and S.
+		/// @note Be careful not to use this function with non-pointers and classes that don't have virtual functions.
+		template <typename L, typename S>
+		inline HashMap<L, S> dynamicCast(bool includeNulls = false) const
+		{
+			HashMap<L, S> result;
+			L key;
+			S value;
+			__foreach_this_hash_map_it(it)
+			{
+				key = dynamic_cast<L>(it->first);
+				value = dynamic_cast<S>(it->second);
+				if (key != NULL && (value != NULL || includeNulls))
+				{
+					result[key] = value;
+				}
+			}
+			return result;
+		}
+		/// @brief Returns a new HashMap with all keys and values dynamically cast into the type L and non-dynamically into S.
+		/// @return A new HashMap with all keys and values cast into the type L and S.
+		/// @note If dynamic casting fails, it won't be included in the result.
+		/// @note Be careful not to use this function with non-pointers and classes that don't have virtual functions.
+		template <typename L, typename S>
+		inline HashMap<L, S> dynamicCastKeys() const
+		{
+			HashMap<L, S> result;
+			L key;
+			__foreach_this_hash_map_it(it)
+			{
+				key = dynamic_cast<L>(it->first);
+				if (key != NULL)
+				{
+					result[key] = (S)it->second;
+				}
+			}
+			return result;
+		}
+		/// @brief Returns a new HashMap with all keys and values cast into the type L and dynamically into S.
+		/// @param[in] includeNulls Whether to include value NULLs that failed to cast.
+		/// @return A new HashMap with all keys and values cast into the type L and S.
+		/// @note Be careful not to use this function with non-pointers and classes that don't have virtual functions.
+		template <typename L, typename S>
+		inline HashMap<L, S> dynamicCastValues(bool includeNulls = false) const
+		{
+			HashMap<L, S> result;
+			S value;
+			__foreach_this_hash_map_it(it)
+			{
+				value = dynamic_cast<S>(it->second);
+				if (value != NULL || includeNulls)
+				{
+					result[(L)it->first] = value;
+				}
+			}
+			return result;
+		}
+		/// @brief Finds and returns value stored at key. In case no value is found, returns the given default value.
+		/// @param[in] key Key to retrieve the value of.
+		/// @param[in] defaultValue Default value to return if key does not exist.
+		/// @return Value stored at key or given default value.
+		inline V tryGet(const K& key, const V& defaultValue) const
+		{
+			int index = this->_find(key, HashMap::_hash(key));
+			return (index >= 0 ? this->entries[index].second : defaultValue);
+		}
+		/// @brief Same as insert.
+		/// @see insert(const HashMap& other)
+		inline HashMap& operator+=(const HashMap& other)
+		{
+			this->insert(other);
+			return (*this);
+		}
+		/// @brief Merges two HashMaps.
+		/// @param[in] other Second HashMap to merge with.
+		/// @return New HashMap with entries of both HashMaps.
+		/// @note Entries with already existing keys in the first HashMap will not be overwritten.
+		inline HashMap operator+(const HashMap& other) const
+		{
+			HashMap result(*this);
+			result += other;
+			return result;
+		}
+
+	protected:
+		template <typename L, typename S, typename I>
+		friend class HashMap;
+
+		/// @brief Table of entries, only slots with a non-zero distance are constructed.
+		entry_t* entries;
+		/// @brief Cached hashes of the keys.
+		size_t* hashes;
+		/// @brief Distance from the ideal slot plus one for each slot, 0 marks an empty slot.
+		unsigned char* distances;
+		/// @brief Number of slots, always a power of 2.
+		int capacity;
+		/// @brief Number of entries.
+		int count;
+
+		/// @brief Calculates the hash of a key.
+		/// @param[in] key The key.
+		/// @return The hash of the key.
+		/// @note The hash is mixed, because slots are selected by its low bits and e.g. the hashes of ints and pointers are the values themselves.
+		static inline size_t _hash(const K& key)
+		{
+			// finalizer of MurmurHash3
+			uint64_t hash = (uint64_t)H()(key);
+			hash ^= hash >> 33;
+			hash *= 0xFF51AFD7ED558CCDULL;
+			hash ^= hash >> 33;
+			hash *= 0xC4CEB9FE1A85EC53ULL;
+			hash ^= hash >> 33;
+			return (size_t)hash;
+		}
+		/// @brief Checks whether inserting a key could make a distance from an ideal slot too large to be stored.
+		/// @param[in] hash Hash of the key.
+		/// @return True if a distance could become too large.
+		/// @note Inserting increases the distance of every entry by at most one up to the next empty slot.
+		inline bool _isProbeTooLong(size_t hash) const
+		{
+			int mask = this->capacity - 1;
+			int index = (int)(hash & mask);
+			for (int length = 1; this->distances[index] != 0; ++length)
+			{
+				if (this->distances[index] >= 255 || length >= 255)
+				{
+					return true;
+				}
+				index = (index + 1) & mask;
+			}
+			return false;
+		}
+		/// @brief Finds the slot of a key.
+		/// @param[in] key Key to search for.
+		/// @param[in] hash Hash of the key.
+		/// @return Index of the slot or -1 if key is not present.
+		inline int _find(const K& key, size_t hash) const
+		{
+			if (this->count == 0)
+			{
+				return -1;
+			}
+			int mask = this->capacity - 1;
+			int index = (int)(hash & mask);
+			// with Robin Hood probing, a key can't be further away from its ideal slot than the entry that is currently in the slot
+			for (int distance = 1; distance <= this->distances[index]; ++distance)
+			{
+				if (this->hashes[index] == hash && this->entries[index].first == key)
+				{
+					return index;
+				}
+				index = (index + 1) & mask;
+			}
+			return -1;
+		}
+		/// @brief Inserts an entry with a key that is not yet present.
+		/// @param[in] entry The entry.
+		/// @param[in] hash Hash of the key.
+		/// @return Index of the slot where the entry was stored.
+		inline int _insertNew(entry_t entry, size_t hash)
+		{
+			if ((this->count + 1) * 100 > this->capacity * HASH_MAP_MAX_LOAD_PERCENT)
+			{
+				this->_rehash(this->capacity > 0 ? this->capacity * 2 : MIN_HASH_MAP_CAPACITY);
+			}
+			// distances are stored in a byte so this is checked before any entries are moved
+			while (this->_isProbeTooLong(hash))
+			{
+				// at a low load, long probe sequences come from many keys with the same hash and growing wouldn't help
+				if ((int64_t)(this->count + 1) * 200 <= (int64_t)this->capacity * HASH_MAP_MAX_LOAD_PERCENT)
+				{
+					throw Exception("Too many keys with the same hash in HashMap!");
+				}
+				this->_rehash(this->capacity * 2);
+			}
+			int result = -1;
+			int mask = this->capacity - 1;
+			int index = (int)(hash & mask);
+			int distance = 1;
+			while (true)
+			{
+				if (this->distances[index] == 0)
+				{
+					new (&this->entries[index]) entry_t(std::move(entry));
+					this->hashes[index] = hash;
+					this->distances[index] = (unsigned char)distance;
+					++this->count;
+					return (result >= 0 ? result : index);
+				}
+				// Robin Hood: the entry that is further away from its ideal slot takes the slot
+				if (this->distances[index] < distance)
+				{
+					std::swap(this->entries[index], entry);
+					std::swap(this->hashes[index], hash);
+					int swappedDistance = this->distances[index];
+					this->distances[index] = (unsigned char)distance;
+					distance = swappedDistance;
+					if (result < 0)
+					{
+						result = index;
+					}
+				}
+				index = (index + 1) & mask;
+				++distance;
+			}
+		}
+		/// @brief Removes the entry in a slot using backward shift deletion.
+		/// @param[in] index Index of the slot.
+		inline void _erase(int index)
+		{
+			int mask = this->capacity - 1;
+			int next = (index + 1) & mask;
+			while (this->distances[next] > 1)
+			{
+				this->entries[index] = std::move(this->entries[next]);
+				this->hashes[index] = this->hashes[next];
+				this->distances[index] = this->distances[next] - 1;
+				index = next;
+				next = (next + 1) & mask;
+			}
+			this->entries[index].~entry_t();
+			this->distances[index] = 0;
+			--this->count;
+		}
+		/// @brief Gets the index of a random occupied slot.
+		/// @return Index of a random occupied slot.
+		inline int _randomIndex() const
+		{
+			int index = hrand(this->capacity);
+			while (this->distances[index] == 0)
+			{
+				index = (index + 1) & (this->capacity - 1);
+			}
+			return index;
+		}
+		/// @brief Allocates a new table and moves all entries into it.
+		/// @param[in] newCapacity Number of slots in the new table.
+		inline void _rehash(int newCapacity)
+		{
+			entry_t* oldEntries = this->entries;
+			size_t* oldHashes = this->hashes;
+			unsigned char* oldDistances = this->distances;
+			int oldCapacity = this->capacity;
+			this->entries = (entry_t*)malloc(sizeof(entry_t) * newCapacity);
+			this->hashes = (size_t*)malloc(sizeof(size_t) * newCapacity);
+			this->distances = (unsigned char*)calloc(newCapacity, sizeof(unsigned char));
+			if (this->entries == NULL || this->hashes == NULL || this->distances == NULL)
+			{
+				free(this->entries);
+				free(this->hashes);
+				free(this->distances);
+				this->entries = oldEntries;
+				this->hashes = oldHashes;
+				this->distances = oldDistances;
+				throw Exception("Could not allocate memory for HashMap!");
+			}
+			this->capacity = newCapacity;
+			this->count = 0;
+			for_iter (i, 0, oldCapacity)
+			{
+				if (oldDistances[i] != 0)
+				{
+					this->_insertNew(std::move(oldEntries[i]), oldHashes[i]);
+					oldEntries[i].~entry_t();
+				}
+			}
+			free(oldEntries);
+			free(oldHashes);
+			free(oldDistances);
+		}
+		/// @brief Copies all entries from another HashMap.
+		/// @param[in] other Another HashMap.
+		inline void _copy(const HashMap& other)
+		{
+			this->reserve(other.count);
+			__foreach_other_hash_map_it(it, other)
+			{
+				this->_insertNew(*it, other.hashes[it.index]);
+			}
+		}
+		/// @brief Destroys all entries and releases the table.
+		inline void _destroy()
+		{
+			if (this->entries != NULL)
+			{
+				this->clear();
+				free(this->entries);
+				free(this->hashes);
+				free(this->distances);
+				this->entries = NULL;
+				this->hashes = NULL;
+				this->distances = NULL;
+				this->capacity = 0;
+			}
+		}
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+#define hhashmap hltypes::HashMap
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#undef __foreach_this_hash_map_it
+#undef __foreach_other_hash_map_it
+#endif
+
+#endif
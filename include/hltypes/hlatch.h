@@ -0,0 +1,76 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides functionality of a single-use countdown latch for multithreading.
+
+#ifndef HLTYPES_LATCH_H
+#define HLTYPES_LATCH_H
+
+#include "hconditionvariable.h"
+#include "hltypesExport.h"
+#include "hmutex.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief Provides functionality of a countdown latch that releases all waiting threads once its counter reaches zero.
+	/// @note A Latch cannot be reset. Use a Barrier if threads have to meet repeatedly.
+	class hltypesExport Latch
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @param[in] count Initial value of the counter.
+		/// @param[in] name The internal name.
+		Latch(int count, const String& name = "");
+		/// @brief Destructor.
+		~Latch();
+
+		/// @brief Returns the latch name.
+		/// @return The latch name.
+		inline String getName() const { return this->name; }
+
+		/// @brief Gets the current value of the counter.
+		/// @return The current value of the counter.
+		int getCount();
+		/// @brief Decreases the counter and releases all waiting threads when it reaches zero.
+		/// @param[in] amount By how much the counter is decreased.
+		void countDown(int amount = 1);
+		/// @brief Waits until the counter reaches zero.
+		void wait();
+		/// @brief Waits until the counter reaches zero or the timeout ran out.
+		/// @param[in] timeout Maximum time to wait in milliseconds.
+		/// @return True if the counter reached zero, false if the timeout ran out.
+		bool wait(float timeout);
+
+	protected:
+		/// @brief Latch name.
+		String name;
+		/// @brief The counter.
+		int count;
+		/// @brief Mutex for the counter.
+		Mutex mutex;
+		/// @brief Condition variable that waiting threads block on.
+		ConditionVariable condition;
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		Latch(const Latch& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		Latch& operator=(Latch& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::Latch hlatch;
+
+#endif
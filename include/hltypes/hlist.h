@@ -14,6 +14,7 @@
 #define HLTYPES_LIST_H
 
 #include <list>
+#include <utility>
 
 #include "hcontainer.h"
 #include "hexception.h"
@@ -177,38 +178,79 @@ namespace hltypes
 		}
 		/// @brief Creates new List with reversed order of elements.
 		/// @return A new List.
-		inline List<T> reversed() const
+		inline List<T> reversed() const&
 		{
 			return this->template _reversed<List<T> >();
 		}
+		/// @brief Same as reversed(), but modifies this temporary List in-place instead of copying it.
+		/// @return This List moved into the result.
+		inline List<T> reversed() &&
+		{
+			this->reverse();
+			return std::move(*this);
+		}
 		/// @brief Creates new List without duplicates.
 		/// @return A new List.
-		inline List<T> removedDuplicates() const
+		inline List<T> removedDuplicates() const&
 		{
 			return this->template _removedDuplicates<List<T> >();
 		}
+		/// @brief Same as removedDuplicates(), but modifies this temporary List in-place instead of copying it.
+		/// @return This List moved into the result.
+		inline List<T> removedDuplicates() &&
+		{
+			this->removeDuplicates();
+			return std::move(*this);
+		}
 		/// @brief Creates new sorted List.
 		/// @return A new List.
 		/// @note The sorting order is ascending.
-		inline List<T> sorted() const
+		inline List<T> sorted() const&
 		{
 			return this->template _sorted<List<T> >();
 		}
+		/// @brief Same as sorted(), but sorts this temporary List in-place instead of copying it.
+		/// @return This List moved into the result.
+		/// @note The sorting order is ascending.
+		inline List<T> sorted() &&
+		{
+			this->sort();
+			return std::move(*this);
+		}
 		/// @brief Creates new sorted List.
-		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
 		/// @return A new List.
 		/// @note The sorting order is ascending.
 		/// @note compareFunction should return true if first element is less than the second element.
-		inline List<T> sorted(bool (*compareFunction)(T const&, T const&)) const
+		template <typename C>
+		inline List<T> sorted(C compareFunction) const&
 		{
 			return this->template _sorted<List<T> >(compareFunction);
 		}
+		/// @brief Same as sorted(compareFunction), but sorts this temporary List in-place instead of copying it.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
+		/// @return This List moved into the result.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		template <typename C>
+		inline List<T> sorted(C compareFunction) &&
+		{
+			this->sort(compareFunction);
+			return std::move(*this);
+		}
 		/// @brief Creates a new List with randomized order of elements.
 		/// @return A new List.
-		inline List<T> randomized() const
+		inline List<T> randomized() const&
 		{
 			return this->template _randomized<List<T> >();
 		}
+		/// @brief Same as randomized(), but modifies this temporary List in-place instead of copying it.
+		/// @return This List moved into the result.
+		inline List<T> randomized() &&
+		{
+			this->randomize();
+			return std::move(*this);
+		}
 		/// @brief Creates a new List as union of this List with an element.
 		/// @param[in] element Element to unite with.
 		/// @return A new List.
@@ -259,10 +301,21 @@ namespace hltypes
 		{
 			return this->template _mapped<List<S>, S>(generateFunction);
 		}
+		/// @brief Creates new List with new elements obtained from the current List elements.
+		/// @param[in] generateFunction Generation function or function object for the new elements.
+		/// @return A new List with the new elements.
+		/// @note The type of the new elements is the return type of generateFunction.
+		template <typename F>
+		inline auto mapped(F generateFunction) const -> List<typename std::decay<decltype(generateFunction(std::declval<const T&>()))>::type>
+		{
+			typedef typename std::decay<decltype(generateFunction(std::declval<const T&>()))>::type S;
+			return this->template _mapped<List<S>, S>(generateFunction);
+		}
 		/// @brief Finds and returns new List of elements that match the condition.
-		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
 		/// @return New List with all matching elements.
-		inline List<T> findAll(bool (*conditionFunction)(T const&)) const
+		template <typename C>
+		inline List<T> findAll(C conditionFunction) const
 		{
 			return this->template _findAll<List<T> >(conditionFunction);
 		}
@@ -327,6 +380,13 @@ namespace hltypes
 			return (*this);
 		}
 		/// @brief Same as add.
+		/// @see add(T&& element)
+		inline List<T>& operator<<(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
 		/// @see add(const List<T>& other)
 		inline List<T>& operator<<(const List<T>& other)
 		{
@@ -341,6 +401,13 @@ namespace hltypes
 			return (*this);
 		}
 		/// @brief Same as add.
+		/// @see add(T&& element)
+		inline List<T>& operator+=(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
 		/// @see add(const List<T>& other)
 		inline List<T>& operator+=(const List<T>& other)
 		{
@@ -268,6 +268,19 @@ hltypesFnExport hltypes::String henv(const hltypes::String& name);
 /// @return Current stack trace.
 /// @note May not be available on all platforms.
 hltypesFnExport hltypes::String hstackTrace(int maxFrames = 62);
+/// @brief Captures the return addresses of the current call stack without resolving their symbols.
+/// @param[out] frames Destination array for the return addresses. It has to be large enough for maxFrames addresses.
+/// @param[in] maxFrames Maximum number of frames.
+/// @return Number of captured frames.
+/// @note This is much cheaper than hstackTrace() and doesn't lock. Returns 0 on platforms where stack traces are not available.
+/// @see hstackResolve
+hltypesFnExport int hstackCapture(void** frames, int maxFrames = 62);
+/// @brief Resolves return addresses captured with hstackCapture() into a stack trace.
+/// @param[in] frames The captured return addresses.
+/// @param[in] count Number of captured return addresses.
+/// @return Stack trace.
+/// @note May not be available on all platforms.
+hltypesFnExport hltypes::String hstackResolve(void* const* frames, int count);
 /// @brief Calculates the free disk space on the device.
 /// @return The free disk space on the device.
 hltypesFnExport uint64_t getFreeDiskSpace();
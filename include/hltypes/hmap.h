@@ -14,6 +14,8 @@
 #define HLTYPES_MAP_H
 
 #include <map>
+#include <type_traits>
+#include <utility>
 
 #include "harray.h"
 #include "hltypesUtil.h"
@@ -59,6 +61,28 @@ namespace hltypes
 			std::map<K, V>(other)
 		{
 		}
+		/// @brief Move constructor.
+		/// @param[in] other Map to move.
+		inline Map(Map<K, V>&& other) noexcept(std::is_nothrow_move_constructible<std::map<K, V> >::value) :
+			std::map<K, V>(std::move(other))
+		{
+		}
+		/// @brief Assignment operator.
+		/// @param[in] other Map to copy.
+		/// @return This Map.
+		inline Map<K, V>& operator=(const Map<K, V>& other)
+		{
+			std::map<K, V>::operator=(other);
+			return (*this);
+		}
+		/// @brief Move assignment operator.
+		/// @param[in] other Map to move.
+		/// @return This Map.
+		inline Map<K, V>& operator=(Map<K, V>&& other) noexcept(std::is_nothrow_move_assignable<std::map<K, V> >::value)
+		{
+			std::map<K, V>::operator=(std::move(other));
+			return (*this);
+		}
 		/// @brief Returns value with specified key.
 		/// @param[in] key Key of the value.
 		/// @return Value with specified key.
@@ -103,7 +127,7 @@ namespace hltypes
 		}
 		/// @brief Returns an Array with all values.
 		/// @return An Array with all values.
-		inline Array<V> values() const
+		inline Array<V> values() const&
 		{
 			Array<V> result;
 			__foreach_this_map_it(it)
@@ -112,9 +136,20 @@ namespace hltypes
 			}
 			return result;
 		}
+		/// @brief Returns an Array with all values moved out of this temporary Map.
+		/// @return An Array with all values.
+		inline Array<V> values() &&
+		{
+			Array<V> result;
+			for (iterator_t it = this->begin(), itEnd = this->end(); it != itEnd; ++it)
+			{
+				result += std::move(it->second);
+			}
+			return result;
+		}
 		/// @brief Returns an Array with all values in the same order as the given corresponding keys.
 		/// @return An Array with all values in the same order as the given corresponding keys.
-		inline Array<V> values(const Array<K> keys) const
+		inline Array<V> values(const Array<K>& keys) const
 		{
 			Array<V> result;
 			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it) // don't change, requires a const iterator
@@ -136,7 +171,7 @@ namespace hltypes
 		}
 		/// @brief Returns an Array with all key-value pairs in the same order as the given corresponding keys.
 		/// @return An Array with all key-value pairs in the same order as the given corresponding keys.
-		inline Array<std::pair<K, V> > keyValuePairs(const Array<K> keys) const
+		inline Array<std::pair<K, V> > keyValuePairs(const Array<K>& keys) const
 		{
 			Array<std::pair<K, V> > result;
 			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it) // don't change, requires a const iterator
@@ -190,6 +225,7 @@ namespace hltypes
 		/// @brief Returns key of specified value.
 		/// @param[in] value Value with the given key.
 		/// @return Key of specified value.
+		/// @note This is a linear search. Use BiMap if keys have to be looked up by value often.
 		inline K keyOf(const V& value) const
 		{
 			__foreach_this_map_it(it)
@@ -280,6 +316,7 @@ namespace hltypes
 		/// @brief Checks for existence of a value.
 		/// @param[in] value Value to check.
 		/// @return True if value is present.
+		/// @note This is a linear search. Use BiMap if values have to be looked up often.
 		inline bool hasValue(const V& value) const
 		{
 			__foreach_this_map_it(it)
@@ -354,7 +391,46 @@ namespace hltypes
 		/// @param[in] value Value of the entry.
 		inline void insert(const K& key, const V& value)
 		{
-			std::map<K, V>::operator[](key) = value;
+			iterator_t it = std::map<K, V>::lower_bound(key);
+			if (it != this->end() && !std::map<K, V>::key_comp()(key, it->first))
+			{
+				it->second = value;
+			}
+			else
+			{
+				std::map<K, V>::insert(it, std::pair<const K, V>(key, value));
+			}
+		}
+		/// @brief Adds a new pair of key and value into the Map by moving them.
+		/// @param[in] key Key of the entry.
+		/// @param[in] value Value of the entry.
+		/// @note The key is only moved if it is not already present in the Map.
+		inline void insert(K&& key, V&& value)
+		{
+			iterator_t it = std::map<K, V>::lower_bound(key);
+			if (it != this->end() && !std::map<K, V>::key_comp()(key, it->first))
+			{
+				it->second = std::move(value);
+			}
+			else
+			{
+				std::map<K, V>::emplace_hint(it, std::move(key), std::move(value));
+			}
+		}
+		/// @brief Adds a new pair of key and value into the Map by moving the value.
+		/// @param[in] key Key of the entry.
+		/// @param[in] value Value of the entry.
+		inline void insert(const K& key, V&& value)
+		{
+			iterator_t it = std::map<K, V>::lower_bound(key);
+			if (it != this->end() && !std::map<K, V>::key_comp()(key, it->first))
+			{
+				it->second = std::move(value);
+			}
+			else
+			{
+				std::map<K, V>::emplace_hint(it, key, std::move(value));
+			}
 		}
 		/// @brief Adds all pairs of keys and values from another Map into this one.
 		/// @param[in] other Another Map.
@@ -406,11 +482,13 @@ namespace hltypes
 		/// @return True if value was present and removed.
 		inline bool removeValue(const V& value)
 		{
-			if (this->hasValue(value))
+			for (iterator_t it = this->begin(), itEnd = this->end(); it != itEnd; ++it)
 			{
-				K result = this->keyOf(value);
-				std::map<K, V>::erase(result);
-				return true;
+				if (it->second == value)
+				{
+					std::map<K, V>::erase(it);
+					return true;
+				}
 			}
 			return false;
 		}
@@ -513,9 +591,10 @@ namespace hltypes
 			return result;
 		}
 		/// @brief Finds and returns new Map with entries that match the condition.
-		/// @param[in] conditionFunction Function pointer with condition function that takes a key of type K and a value of type V and returns bool.
+		/// @param[in] conditionFunction Condition function or function object that takes a key of type K and a value of type V and returns bool.
 		/// @return New Map with all matching elements.
-		inline Map<K, V> findAll(bool (*conditionFunction)(K const&, V const&)) const
+		template <typename C>
+		inline Map<K, V> findAll(C conditionFunction) const
 		{
 			Map<K, V> result;
 			__foreach_this_map_it(it)
@@ -528,9 +607,10 @@ namespace hltypes
 			return result;
 		}
 		/// @brief Checks if at least one entry matches the condition.
-		/// @param[in] conditionFunction Function pointer with condition function that takes a key of type K and a value of type V and returns bool.
+		/// @param[in] conditionFunction Condition function or function object that takes a key of type K and a value of type V and returns bool.
 		/// @return True if at least one entry matches the condition.
-		inline bool matchesAny(bool (*conditionFunction)(K const&, V const&)) const
+		template <typename C>
+		inline bool matchesAny(C conditionFunction) const
 		{
 			__foreach_this_map_it(it)
 			{
@@ -542,9 +622,10 @@ namespace hltypes
 			return false;
 		}
 		/// @brief Checks if all entries match the condition.
-		/// @param[in] conditionFunction Function pointer with condition function that takes a key of type K and a value of type V and returns bool.
+		/// @param[in] conditionFunction Condition function or function object that takes a key of type K and a value of type V and returns bool.
 		/// @return True if all entries match the condition.
-		inline bool matchesAll(bool (*conditionFunction)(K const&, V const&)) const
+		template <typename C>
+		inline bool matchesAll(C conditionFunction) const
 		{
 			__foreach_this_map_it(it)
 			{
@@ -0,0 +1,197 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides a bounded lock-free queue for many producer and many consumer threads.
+
+#ifndef HLTYPES_MPMC_QUEUE_H
+#define HLTYPES_MPMC_QUEUE_H
+
+#include <stddef.h>
+#include <utility>
+
+#include "hatomic.h"
+#include "hexception.h"
+
+namespace hltypes
+{
+	/// @brief Bounded lock-free queue that any number of threads can push to and pop from at the same time.
+	/// @note It is a ring buffer where every slot has a sequence number that tells producers and consumers whether the slot is free or filled.
+	/// @note T has to be default-constructible and movable. Popped slots keep a moved-from T until they are reused.
+	template <typename T>
+	class MpmcQueue
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @param[in] capacity Maximum number of queued elements. It is rounded up to the next power of two.
+		MpmcQueue(int capacity) : slots(NULL), mask(0)
+		{
+			size_t size = 2;
+			while (size < (size_t)capacity)
+			{
+				size <<= 1;
+			}
+			this->mask = size - 1;
+			this->slots = new Slot[size];
+			for (size_t i = 0; i < size; ++i)
+			{
+				this->slots[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+		/// @brief Destructor.
+		/// @note No other thread may access the queue anymore.
+		~MpmcQueue()
+		{
+			delete [] this->slots;
+		}
+
+		/// @brief Gets the maximum number of queued elements.
+		/// @return The maximum number of queued elements.
+		inline int getCapacity() const
+		{
+			return (int)(this->mask + 1);
+		}
+		/// @brief Gets the number of queued elements.
+		/// @return The number of queued elements.
+		/// @note The result is only a snapshot if other threads are using the queue.
+		inline int size() const
+		{
+			size_t tail = this->tail.load(std::memory_order_relaxed);
+			size_t head = this->head.load(std::memory_order_relaxed);
+			return (tail > head ? (int)(tail - head) : 0);
+		}
+		/// @brief Checks whether the queue is empty.
+		/// @return True if the queue is empty.
+		/// @note The result is only a snapshot if other threads are using the queue.
+		inline bool isEmpty() const
+		{
+			return (this->size() == 0);
+		}
+
+		/// @brief Adds an element to the end of the queue.
+		/// @param[in] element Element to add.
+		/// @return False if the queue is full.
+		inline bool push(const T& element)
+		{
+			T copy(element);
+			return this->push(std::move(copy));
+		}
+		/// @brief Adds an element to the end of the queue.
+		/// @param[in] element Element to add, it is moved into the queue.
+		/// @return False if the queue is full.
+		inline bool push(T&& element)
+		{
+			size_t position = this->tail.load(std::memory_order_relaxed);
+			Slot* slot = NULL;
+			while (true)
+			{
+				slot = &this->slots[position & this->mask];
+				size_t sequence = slot->sequence.load(std::memory_order_acquire);
+				ptrdiff_t difference = (ptrdiff_t)sequence - (ptrdiff_t)position;
+				if (difference == 0)
+				{
+					if (this->tail.compareExchangeWeak(position, position + 1, std::memory_order_relaxed, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (difference < 0) // the slot still holds an element from the previous round
+				{
+					return false;
+				}
+				else // another producer claimed the slot in the meantime
+				{
+					position = this->tail.load(std::memory_order_relaxed);
+				}
+			}
+			slot->element = std::move(element);
+			slot->sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+		/// @brief Removes the first element of the queue.
+		/// @param[out] element The removed element.
+		/// @return False if the queue is empty.
+		inline bool pop(T& element)
+		{
+			size_t position = this->head.load(std::memory_order_relaxed);
+			Slot* slot = NULL;
+			while (true)
+			{
+				slot = &this->slots[position & this->mask];
+				size_t sequence = slot->sequence.load(std::memory_order_acquire);
+				ptrdiff_t difference = (ptrdiff_t)sequence - (ptrdiff_t)(position + 1);
+				if (difference == 0)
+				{
+					if (this->head.compareExchangeWeak(position, position + 1, std::memory_order_relaxed, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (difference < 0) // the slot hasn't been filled yet
+				{
+					return false;
+				}
+				else // another consumer claimed the slot in the meantime
+				{
+					position = this->head.load(std::memory_order_relaxed);
+				}
+			}
+			element = std::move(slot->element);
+			slot->sequence.store(position + this->mask + 1, std::memory_order_release);
+			return true;
+		}
+
+	protected:
+		/// @brief A slot of the ring buffer.
+		struct Slot
+		{
+			/// @brief Equals the position of the slot when it's free and the position + 1 when it's filled.
+			Atomic<size_t> sequence;
+			/// @brief The element.
+			T element;
+		};
+
+		/// @brief The ring buffer.
+		Slot* slots;
+		/// @brief Capacity - 1, used to turn positions into indices.
+		size_t mask;
+		/// @brief Keeps the consumer position away from the cache line of the other members.
+		char _padding0[HL_CACHE_LINE_SIZE];
+		/// @brief Position of the next element that is popped.
+		Atomic<size_t> head;
+		/// @brief Keeps the producer position away from the cache line of the consumer position.
+		char _padding1[HL_CACHE_LINE_SIZE - sizeof(Atomic<size_t>)];
+		/// @brief Position where the next element is pushed.
+		Atomic<size_t> tail;
+		/// @brief Keeps the producer position away from the cache line of following data.
+		char _padding2[HL_CACHE_LINE_SIZE - sizeof(Atomic<size_t>)];
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		MpmcQueue(const MpmcQueue<T>& other)
+		{
+			throw ObjectCannotCopyException("hltypes::MpmcQueue");
+		}
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		MpmcQueue<T>& operator=(MpmcQueue<T>& other)
+		{
+			throw ObjectCannotAssignException("hltypes::MpmcQueue");
+			return (*this);
+		}
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+#define hmpmcqueue hltypes::MpmcQueue
+
+#endif
@@ -13,19 +13,26 @@
 #ifndef HLTYPES_MUTEX_H
 #define HLTYPES_MUTEX_H
 
+#include "hatomic.h"
 #include "hltypesExport.h"
 #include "hstring.h"
 
 namespace hltypes
 {
+	class ConditionVariable;
+
 	/// @brief Provides functionality of a Mutex for multithreading.
 	class hltypesExport Mutex
 	{
 	public:
+		friend class ConditionVariable;
+
 		/// @brief Utility class for exception-safe Mutex-locking within a scope.
 		class hltypesExport ScopeLock
 		{
 		public:
+			friend class ConditionVariable;
+
 			/// @brief Basic constructor.
 			/// @param[in] mutex The mutex to lock.
 			/// @param[in] logUnhandledUnlocks Whether to log an automatic unlock when the ScopeLock is destroyed by going out of scope (usually on an exception).
@@ -90,7 +97,7 @@ namespace hltypes
 		/// @brief Mutex name.
 		String name;
 		/// @brief Used internallly on Win32 so the much faster critical sections can be used instead of mutices and semaphores.
-		bool locked;
+		Atomic<bool> locked;
 
 	private:
 		/// @brief Copy constructor.
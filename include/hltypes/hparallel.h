@@ -0,0 +1,238 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides utility functions for splitting work on ranges across multiple threads.
+
+#ifndef HLTYPES_PARALLEL_H
+#define HLTYPES_PARALLEL_H
+
+#include <algorithm>
+#include <iterator>
+#include <stddef.h>
+#include <utility>
+#include <vector>
+
+#include "hltypesExport.h"
+
+/// @brief Minimum number of elements in a range before work is split across multiple threads.
+#define PARALLEL_MIN_SIZE 16384
+/// @brief Minimum number of elements processed by one thread.
+#define PARALLEL_MIN_CHUNK_SIZE 4096
+
+namespace hltypes
+{
+	class ThreadPool;
+
+	/// @brief Provides utility functions for splitting work on ranges across multiple threads.
+	/// @note Ranges are always split into contiguous chunks and results are combined in chunk order so the results are the same as with the serial algorithms.
+	/// @note Ranges with fewer than PARALLEL_MIN_SIZE elements are processed on the calling thread.
+	class hltypesExport Parallel
+	{
+	public:
+		/// @brief Gets the number of hardware threads.
+		/// @return Number of hardware threads.
+		static int getConcurrency();
+		/// @brief Gets the number of chunks a range should be split into.
+		/// @param[in] size Number of elements in the range.
+		/// @return Number of chunks or 1 if the range should be processed serially.
+		static int getChunkCount(int size);
+		/// @brief Runs a function multiple times in parallel and waits until all calls have finished.
+		/// @param[in] function Function that takes the call index and the custom data pointer.
+		/// @param[in] data Custom data pointer passed to every call.
+		/// @param[in] count Number of calls.
+		/// @note Call 0 runs on the calling thread and the other calls are executed by a shared ThreadPool. If any call throws an exception, the exception of the call with the lowest index is rethrown after all calls have finished.
+		static void run(void (*function)(int, void*), void* data, int count);
+
+		/// @brief Stable sorts a range.
+		/// @param[in] begin Iterator at the beginning of the range.
+		/// @param[in] end Iterator at the end of the range.
+		/// @param[in] compare Comparison that returns true if the first element is less than the second element.
+		/// @note Chunks are stable sorted in parallel and then merged pairwise, keeping the order of equal elements.
+		template <typename I, typename C>
+		static inline void sort(I begin, I end, C compare)
+		{
+			_RangeData<I, C> data(begin, end, compare);
+			Parallel::run(&Parallel::_sortChunk<I, C>, &data, data.chunks);
+			for (data.width = 1; data.width < data.chunks; data.width *= 2)
+			{
+				Parallel::run(&Parallel::_mergeChunks<I, C>, &data, (data.chunks + data.width * 2 - 1) / (data.width * 2));
+			}
+		}
+		/// @brief Counts all elements in a range that match a condition.
+		/// @param[in] begin Iterator at the beginning of the range.
+		/// @param[in] end Iterator at the end of the range.
+		/// @param[in] condition Condition that takes one element and returns bool.
+		/// @return Number of matching elements.
+		template <typename I, typename C>
+		static inline int count(I begin, I end, C condition)
+		{
+			_RangeData<I, C> data(begin, end, condition);
+			std::vector<int> counts(data.chunks, 0);
+			data.output = &counts;
+			Parallel::run(&Parallel::_countChunk<I, C>, &data, data.chunks);
+			int result = 0;
+			for (std::vector<int>::const_iterator it = counts.begin(); it != counts.end(); ++it)
+			{
+				result += (*it);
+			}
+			return result;
+		}
+		/// @brief Adds all elements of a range that match a condition to a result container.
+		/// @param[in] begin Iterator at the beginning of the range.
+		/// @param[in] end Iterator at the end of the range.
+		/// @param[in,out] result Container with an add() method that the matching elements are added to.
+		/// @param[in] condition Condition that takes one element and returns bool.
+		/// @note The matching elements are added in the same order as they appear in the range.
+		template <typename I, typename R, typename C>
+		static inline void findAll(I begin, I end, R& result, C condition)
+		{
+			typedef typename std::iterator_traits<I>::value_type T;
+			_RangeData<I, C> data(begin, end, condition);
+			std::vector<std::vector<T> > chunks(data.chunks);
+			data.output = &chunks;
+			Parallel::run(&Parallel::_findAllChunk<I, C, T>, &data, data.chunks);
+			Parallel::_addChunks(result, chunks);
+		}
+		/// @brief Adds the results of a function applied to every element of a range to a result container.
+		/// @param[in] begin Iterator at the beginning of the range.
+		/// @param[in] end Iterator at the end of the range.
+		/// @param[in,out] result Container with an add() method that the new elements are added to.
+		/// @param[in] function Function that takes one element and returns the new element.
+		/// @note The new elements are added in the same order as they appear in the range.
+		template <typename I, typename R, typename S, typename F>
+		static inline void map(I begin, I end, R& result, F function)
+		{
+			_RangeData<I, F> data(begin, end, function);
+			std::vector<std::vector<S> > chunks(data.chunks);
+			data.output = &chunks;
+			Parallel::run(&Parallel::_mapChunk<I, F, S>, &data, data.chunks);
+			Parallel::_addChunks(result, chunks);
+		}
+
+	protected:
+		/// @brief Gets the pool that executes the calls of run().
+		/// @return The pool.
+		static ThreadPool* _getPool();
+
+		/// @brief Shared data of all chunks of a range.
+		template <typename I, typename F>
+		struct _RangeData
+		{
+			/// @brief Iterator at the beginning of the range.
+			I begin;
+			/// @brief Number of elements.
+			int size;
+			/// @brief Number of chunks.
+			int chunks;
+			/// @brief Number of already merged chunks in each half of a merge.
+			int width;
+			/// @brief The function applied to the elements.
+			F function;
+			/// @brief Per-chunk output.
+			void* output;
+
+			inline _RangeData(I begin, I end, F function) : begin(begin), size((int)std::distance(begin, end)), width(1), function(function), output(NULL)
+			{
+				this->chunks = Parallel::getChunkCount(this->size);
+			}
+			/// @brief Gets the iterator at the beginning of a chunk.
+			/// @param[in] index Index of the chunk, chunks is the end of the range.
+			/// @return The iterator object.
+			inline I at(int index) const
+			{
+				return this->begin + (int)((long long)this->size * index / this->chunks);
+			}
+
+		};
+
+		/// @brief Stable sorts one chunk.
+		template <typename I, typename C>
+		static void _sortChunk(int index, void* data)
+		{
+			_RangeData<I, C>* range = (_RangeData<I, C>*)data;
+			std::stable_sort(range->at(index), range->at(index + 1), range->function);
+		}
+		/// @brief Merges two neighbouring groups of already sorted chunks.
+		template <typename I, typename C>
+		static void _mergeChunks(int index, void* data)
+		{
+			_RangeData<I, C>* range = (_RangeData<I, C>*)data;
+			int first = index * range->width * 2;
+			int middle = first + range->width;
+			if (middle < range->chunks)
+			{
+				int last = std::min(middle + range->width, range->chunks);
+				std::inplace_merge(range->at(first), range->at(middle), range->at(last), range->function);
+			}
+		}
+		/// @brief Counts matching elements in one chunk.
+		template <typename I, typename C>
+		static void _countChunk(int index, void* data)
+		{
+			_RangeData<I, C>* range = (_RangeData<I, C>*)data;
+			int result = 0;
+			for (I it = range->at(index), end = range->at(index + 1); it != end; ++it)
+			{
+				if (range->function(*it))
+				{
+					++result;
+				}
+			}
+			(*(std::vector<int>*)range->output)[index] = result;
+		}
+		/// @brief Collects matching elements in one chunk.
+		template <typename I, typename C, typename T>
+		static void _findAllChunk(int index, void* data)
+		{
+			_RangeData<I, C>* range = (_RangeData<I, C>*)data;
+			std::vector<T>& output = (*(std::vector<std::vector<T> >*)range->output)[index];
+			for (I it = range->at(index), end = range->at(index + 1); it != end; ++it)
+			{
+				if (range->function(*it))
+				{
+					output.push_back(*it);
+				}
+			}
+		}
+		/// @brief Maps all elements in one chunk.
+		template <typename I, typename F, typename S>
+		static void _mapChunk(int index, void* data)
+		{
+			_RangeData<I, F>* range = (_RangeData<I, F>*)data;
+			std::vector<S>& output = (*(std::vector<std::vector<S> >*)range->output)[index];
+			I it = range->at(index);
+			I end = range->at(index + 1);
+			output.reserve(std::distance(it, end));
+			for (; it != end; ++it)
+			{
+				output.push_back(range->function(*it));
+			}
+		}
+		/// @brief Moves the per-chunk results into a result container in chunk order.
+		template <typename R, typename T>
+		static inline void _addChunks(R& result, std::vector<std::vector<T> >& chunks)
+		{
+			for (typename std::vector<std::vector<T> >::iterator it = chunks.begin(); it != chunks.end(); ++it)
+			{
+				for (typename std::vector<T>::iterator it2 = it->begin(); it2 != it->end(); ++it2)
+				{
+					result.add(std::move(*it2));
+				}
+			}
+		}
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::Parallel hparallel;
+
+#endif
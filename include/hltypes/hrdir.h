@@ -16,6 +16,7 @@
 #include "harray.h"
 #include "hdbase.h"
 #include "hltypesExport.h"
+#include "hhashmap.h"
 #include "hmap.h"
 #include "hresource.h"
 #include "hstring.h"
@@ -62,10 +63,10 @@ namespace hltypes
 	protected:
 		/// @brief Cache for directory entries.
 		/// @note This is usually only used when ZIP resources are being used.
-		static Map<String, Array<String> > cacheDirectories;
+		static HashMap<String, Array<String> > cacheDirectories;
 		/// @brief Cache for file entries.
 		/// @note This is usually only used when ZIP resources are being used.
-		static Map<String, Array<String> > cacheFiles;
+		static HashMap<String, Array<String> > cacheFiles;
 
 		/// @brief Basic constructor.
 		/// @note Forces this to be a static class.
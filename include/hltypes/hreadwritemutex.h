@@ -0,0 +1,187 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides functionality of a reader-writer mutex for multithreading.
+
+#ifndef HLTYPES_READ_WRITE_MUTEX_H
+#define HLTYPES_READ_WRITE_MUTEX_H
+
+#include "hltypesExport.h"
+#include "hstring.h"
+
+// size of the inline OS handle storage, pthread_rwlock_t is the largest on Apple and SRWLOCK only has the size of a pointer
+#ifdef _WIN32
+	#define HL_READ_WRITE_MUTEX_HANDLE_SIZE 8
+#elif defined(__APPLE__)
+	#define HL_READ_WRITE_MUTEX_HANDLE_SIZE 200
+#else
+	#define HL_READ_WRITE_MUTEX_HANDLE_SIZE 64
+#endif
+
+namespace hltypes
+{
+	/// @brief Provides functionality of a Mutex that can be locked by many readers or one writer at the same time.
+	/// @note Use this for data that is read often and changed rarely.
+	/// @note The read lock is not recursive. A thread that holds any lock must not try to get another one of the same ReadWriteMutex.
+	class hltypesExport ReadWriteMutex
+	{
+	public:
+		/// @brief Utility class for exception-safe read-locking within a scope.
+		class hltypesExport ReadScopeLock
+		{
+		public:
+			/// @brief Basic constructor.
+			/// @param[in] mutex The mutex to read-lock.
+			inline ReadScopeLock(ReadWriteMutex* mutex = NULL) : mutex(NULL)
+			{
+				this->acquire(mutex);
+			}
+			/// @brief Destructor.
+			inline ~ReadScopeLock()
+			{
+				this->release();
+			}
+
+			/// @brief Read-locks the ReadWriteMutex.
+			/// @param[in] mutex The mutex to read-lock.
+			/// @return True if lock succeeded. False if there is already an assigned ReadWriteMutex.
+			inline bool acquire(ReadWriteMutex* mutex)
+			{
+				if (this->mutex == NULL && mutex != NULL)
+				{
+					this->mutex = mutex;
+					this->mutex->lockRead();
+					return true;
+				}
+				return false;
+			}
+			/// @brief Unlocks the ReadWriteMutex.
+			/// @return True if unlock succeeded. False if there is no assigned ReadWriteMutex.
+			inline bool release()
+			{
+				if (this->mutex != NULL)
+				{
+					this->mutex->unlockRead();
+					this->mutex = NULL;
+					return true;
+				}
+				return false;
+			}
+
+		protected:
+			/// @brief The ReadWriteMutex.
+			ReadWriteMutex* mutex;
+
+		};
+
+		/// @brief Utility class for exception-safe write-locking within a scope.
+		class hltypesExport WriteScopeLock
+		{
+		public:
+			/// @brief Basic constructor.
+			/// @param[in] mutex The mutex to write-lock.
+			inline WriteScopeLock(ReadWriteMutex* mutex = NULL) : mutex(NULL)
+			{
+				this->acquire(mutex);
+			}
+			/// @brief Destructor.
+			inline ~WriteScopeLock()
+			{
+				this->release();
+			}
+
+			/// @brief Write-locks the ReadWriteMutex.
+			/// @param[in] mutex The mutex to write-lock.
+			/// @return True if lock succeeded. False if there is already an assigned ReadWriteMutex.
+			inline bool acquire(ReadWriteMutex* mutex)
+			{
+				if (this->mutex == NULL && mutex != NULL)
+				{
+					this->mutex = mutex;
+					this->mutex->lockWrite();
+					return true;
+				}
+				return false;
+			}
+			/// @brief Unlocks the ReadWriteMutex.
+			/// @return True if unlock succeeded. False if there is no assigned ReadWriteMutex.
+			inline bool release()
+			{
+				if (this->mutex != NULL)
+				{
+					this->mutex->unlockWrite();
+					this->mutex = NULL;
+					return true;
+				}
+				return false;
+			}
+
+		protected:
+			/// @brief The ReadWriteMutex.
+			ReadWriteMutex* mutex;
+
+		};
+
+		/// @brief Basic constructor.
+		/// @param[in] name The internal name.
+		ReadWriteMutex(const String& name = "");
+		/// @brief Destructor.
+		~ReadWriteMutex();
+
+		/// @brief Returns the mutex name.
+		/// @return The mutex name.
+		inline String getName() const { return this->name; }
+
+		/// @brief Locks the ReadWriteMutex for reading.
+		/// @note Waits while another thread holds the write lock.
+		void lockRead();
+		/// @brief Tries to lock the ReadWriteMutex for reading without waiting.
+		/// @return True if the lock was acquired.
+		bool tryLockRead();
+		/// @brief Unlocks a read lock.
+		void unlockRead();
+		/// @brief Locks the ReadWriteMutex for writing.
+		/// @note Waits while any other thread holds a read or write lock.
+		void lockWrite();
+		/// @brief Tries to lock the ReadWriteMutex for writing without waiting.
+		/// @return True if the lock was acquired.
+		bool tryLockWrite();
+		/// @brief Unlocks the write lock.
+		void unlockWrite();
+
+	protected:
+		/// @brief Storage of the OS handle so it doesn't have to be allocated separately.
+		union
+		{
+			/// @brief The OS handle.
+			unsigned char data[HL_READ_WRITE_MUTEX_HANDLE_SIZE];
+			/// @brief Forces an alignment that is suitable for the OS handle.
+			long long alignment;
+			/// @brief Forces an alignment that is suitable for the OS handle.
+			void* pointerAlignment;
+		} handle;
+		/// @brief Mutex name.
+		String name;
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		ReadWriteMutex(const ReadWriteMutex& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		ReadWriteMutex& operator=(ReadWriteMutex& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::ReadWriteMutex hreadwritemutex;
+
+#endif
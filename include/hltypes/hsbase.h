@@ -17,6 +17,7 @@
 #include <stdio.h>
 
 #include "harray.h"
+#include "hatomic.h"
 #include "henum.h"
 #include "hltypesExport.h"
 #include "hstring.h"
@@ -217,7 +218,8 @@ namespace hltypes
 		
 	protected:
 		/// @brief Data size, mostly used for optimization and faster "eof" detection.
-		int64_t dataSize;
+		/// @note Atomic since positional writes can grow it from multiple threads while size() is called.
+		Atomic<int64_t> dataSize;
 
 		/// @brief Updates internal data size.
 		virtual void _updateDataSize();
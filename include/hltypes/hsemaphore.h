@@ -19,12 +19,13 @@
 namespace hltypes
 {
 	/// @brief Provides functionality of a Semaphore for multithreading.
+	/// @note The Semaphore is only visible within the process. It isn't a named system object.
 	class hltypesExport Semaphore
 	{
 	public:
 		/// @brief Basic constructor.
 		/// @param[in] maxCount The max lock count.
-		/// @param[in] name The internal name.
+		/// @param[in] name The internal name. It is not used as a system name so it doesn't have to be unique.
 		Semaphore(int maxCount, const String& name = "");
 		/// @brief Destructor.
 		~Semaphore();
@@ -39,6 +40,14 @@ namespace hltypes
 		/// @brief Decreases the lock counter of the Semaphore.
 		/// @note If the lock counter is zero, the caller thread will wait until a previous thread increases it.
 		void lock();
+		/// @brief Decreases the lock counter of the Semaphore if it isn't zero without waiting.
+		/// @return True if the lock counter was decreased.
+		bool tryLock();
+		/// @brief Decreases the lock counter of the Semaphore.
+		/// @param[in] timeout Maximum time to wait in milliseconds.
+		/// @return True if the lock counter was decreased, false if the timeout ran out.
+		/// @note If the lock counter is zero, the caller thread will wait until a previous thread increases it or the timeout runs out.
+		bool lock(float timeout);
 		/// @brief Increases the lock counter of the Semaphore.
 		/// @note Use this when you're done with thread-safe sections of your code.
 		void unlock();
@@ -0,0 +1,927 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides an Array variant with inline storage for a small number of elements.
+
+#ifndef HLTYPES_SMALL_ARRAY_H
+#define HLTYPES_SMALL_ARRAY_H
+
+#include <algorithm>
+#include <iterator>
+#include <new>
+#include <stddef.h>
+#include <type_traits>
+#include <utility>
+
+#include "harray.h"
+#include "hcontainer.h"
+#include "hexception.h"
+#include "hltypesUtil.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief Vector with inline storage for N elements that provides the part of the std::vector interface used by Container.
+	/// @note The heap is only used when more than N elements are stored. Iterators are plain pointers.
+	/// @note Moving takes over the heap memory of the other vector or moves its elements one by one if they are in the inline storage.
+	template <typename T, int N>
+	class SmallVector
+	{
+	public:
+		typedef T value_type;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef T* pointer;
+		typedef const T* const_pointer;
+		typedef T* iterator;
+		typedef const T* const_iterator;
+		typedef std::reverse_iterator<T*> reverse_iterator;
+		typedef std::reverse_iterator<const T*> const_reverse_iterator;
+
+		/// @brief Empty constructor.
+		inline SmallVector() : data((T*)this->storage), count(0), capacity(N)
+		{
+		}
+		/// @brief Copy constructor.
+		/// @param[in] other SmallVector to copy.
+		inline SmallVector(const SmallVector& other) : data((T*)this->storage), count(0), capacity(N)
+		{
+			this->insert(this->end(), other.begin(), other.end());
+		}
+		/// @brief Move constructor.
+		/// @param[in] other SmallVector to move.
+		inline SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) : data((T*)this->storage), count(0), capacity(N)
+		{
+			this->_take(other);
+		}
+		/// @brief Destructor.
+		inline ~SmallVector()
+		{
+			this->clear();
+			this->_free();
+		}
+		/// @brief Assignment operator.
+		/// @param[in] other SmallVector to copy.
+		/// @return This SmallVector.
+		inline SmallVector& operator=(const SmallVector& other)
+		{
+			if (this != &other)
+			{
+				this->clear();
+				this->insert(this->end(), other.begin(), other.end());
+			}
+			return (*this);
+		}
+		/// @brief Move assignment operator.
+		/// @param[in] other SmallVector to move.
+		/// @return This SmallVector.
+		inline SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+		{
+			if (this != &other)
+			{
+				this->clear();
+				this->_take(other);
+			}
+			return (*this);
+		}
+
+		inline iterator begin() { return this->data; }
+		inline const_iterator begin() const { return this->data; }
+		inline iterator end() { return (this->data + this->count); }
+		inline const_iterator end() const { return (this->data + this->count); }
+		inline reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+		inline const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+		inline reverse_iterator rend() { return reverse_iterator(this->begin()); }
+		inline const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+		inline size_type size() const { return this->count; }
+		inline bool empty() const { return (this->count == 0); }
+		inline T& front() { return this->data[0]; }
+		inline const T& front() const { return this->data[0]; }
+		inline T& back() { return this->data[this->count - 1]; }
+		inline const T& back() const { return this->data[this->count - 1]; }
+
+		/// @brief Makes sure that a number of elements fits without reallocating.
+		/// @param[in] newCapacity Number of elements.
+		inline void reserve(size_type newCapacity)
+		{
+			if (newCapacity > this->capacity)
+			{
+				this->_reallocate(newCapacity, 0, [](T*, size_type) { });
+			}
+		}
+		/// @brief Destroys all elements.
+		/// @note The memory is kept.
+		inline void clear()
+		{
+			for (size_type i = 0; i < this->count; ++i)
+			{
+				this->data[i].~T();
+			}
+			this->count = 0;
+		}
+		/// @brief Constructs an element at the end.
+		/// @param[in] args Arguments for the constructor of T.
+		template <typename... Args>
+		inline void emplace_back(Args&&... args)
+		{
+			this->_append(1, [&args...](T* target, size_type) { new (target) T(std::forward<Args>(args)...); });
+		}
+		inline void push_back(const T& element) { this->emplace_back(element); }
+		inline void push_back(T&& element) { this->emplace_back(std::move(element)); }
+		/// @brief Destroys the last element.
+		inline void pop_back()
+		{
+			--this->count;
+			this->data[this->count].~T();
+		}
+		/// @brief Constructs an element at a position.
+		/// @param[in] position Position of the new element.
+		/// @param[in] args Arguments for the constructor of T.
+		/// @return Iterator of the new element.
+		template <typename... Args>
+		inline iterator emplace(const_iterator position, Args&&... args)
+		{
+			size_type index = position - this->data;
+			this->_append(1, [&args...](T* target, size_type) { new (target) T(std::forward<Args>(args)...); });
+			return this->_rotateIn(index, 1);
+		}
+		inline iterator insert(const_iterator position, const T& element) { return this->emplace(position, element); }
+		inline iterator insert(const_iterator position, T&& element) { return this->emplace(position, std::move(element)); }
+		/// @brief Inserts copies of an element at a position.
+		/// @param[in] position Position of the new elements.
+		/// @param[in] times Number of copies.
+		/// @param[in] element Element to copy.
+		/// @return Iterator of the first new element.
+		inline iterator insert(const_iterator position, size_type times, const T& element)
+		{
+			size_type index = position - this->data;
+			const T* source = &element;
+			this->_append(times, [source](T* target, size_type) { new (target) T(*source); });
+			return this->_rotateIn(index, times);
+		}
+		/// @brief Inserts copies of a range of elements at a position.
+		/// @param[in] position Position of the new elements.
+		/// @param[in] first Start of the range.
+		/// @param[in] last End of the range.
+		/// @return Iterator of the first new element.
+		template <typename I, typename = typename std::enable_if<!std::is_integral<I>::value>::type>
+		inline iterator insert(const_iterator position, I first, I last)
+		{
+			size_type index = position - this->data;
+			size_type size = (size_type)std::distance(first, last);
+			this->_append(size, [&first](T* target, size_type) { new (target) T(*first); ++first; });
+			return this->_rotateIn(index, size);
+		}
+		/// @brief Replaces all elements with copies of a range of elements.
+		/// @param[in] first Start of the range.
+		/// @param[in] last End of the range.
+		template <typename I, typename = typename std::enable_if<!std::is_integral<I>::value>::type>
+		inline void assign(I first, I last)
+		{
+			this->clear();
+			this->insert(this->end(), first, last);
+		}
+		/// @brief Removes an element.
+		/// @param[in] position Position of the element.
+		/// @return Iterator of the element after the removed one.
+		inline iterator erase(const_iterator position)
+		{
+			return this->erase(position, position + 1);
+		}
+		/// @brief Removes a range of elements.
+		/// @param[in] first Start of the range.
+		/// @param[in] last End of the range.
+		/// @return Iterator of the element after the removed ones.
+		inline iterator erase(const_iterator first, const_iterator last)
+		{
+			iterator result = this->data + (first - this->data);
+			size_type size = last - first;
+			if (size > 0)
+			{
+				std::move(result + size, this->end(), result);
+				for (size_type i = this->count - size; i < this->count; ++i)
+				{
+					this->data[i].~T();
+				}
+				this->count -= size;
+			}
+			return result;
+		}
+
+	protected:
+		/// @brief The elements, points to storage or to heap memory.
+		T* data;
+		/// @brief Number of elements.
+		size_type count;
+		/// @brief Number of elements that fit into data.
+		size_type capacity;
+		/// @brief Inline storage for N elements.
+		/// @note Using double and void* for the alignment to stay compatible with compilers that don't support alignas.
+		union
+		{
+			unsigned char storage[N * sizeof(T)];
+			double _alignDouble;
+			void* _alignPointer;
+			long long _alignLongLong;
+		};
+
+		/// @brief Checks whether the elements are in the inline storage.
+		/// @return True if the elements are in the inline storage.
+		inline bool _isInline() const
+		{
+			return (this->data == (const T*)this->storage);
+		}
+		/// @brief Releases heap memory.
+		inline void _free()
+		{
+			if (!this->_isInline())
+			{
+				::operator delete(this->data);
+			}
+		}
+		/// @brief Takes over the elements of another SmallVector.
+		/// @param[in] other SmallVector to move. It's empty afterwards.
+		/// @note This SmallVector has to be empty.
+		inline void _take(SmallVector& other)
+		{
+			if (other._isInline())
+			{
+				this->insert(this->end(), std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+				other.clear();
+				return;
+			}
+			this->_free();
+			this->data = other.data;
+			this->count = other.count;
+			this->capacity = other.capacity;
+			other.data = (T*)other.storage;
+			other.count = 0;
+			other.capacity = N;
+		}
+		/// @brief Moves the elements into new heap memory after constructing new elements behind them.
+		/// @param[in] newCapacity Number of elements that fit into the new memory.
+		/// @param[in] size Number of new elements.
+		/// @param[in] construct Function that constructs a new element at a target address.
+		/// @note The new elements are constructed first so they can be copied from elements of this SmallVector.
+		template <typename F>
+		inline void _reallocate(size_type newCapacity, size_type size, F construct)
+		{
+			T* newData = (T*)::operator new(newCapacity * sizeof(T));
+			size_type constructed = 0;
+			try
+			{
+				for (; constructed < size; ++constructed)
+				{
+					construct(newData + this->count + constructed, constructed);
+				}
+			}
+			catch (...)
+			{
+				for (size_type i = 0; i < constructed; ++i)
+				{
+					newData[this->count + i].~T();
+				}
+				::operator delete(newData);
+				throw;
+			}
+			for (size_type i = 0; i < this->count; ++i)
+			{
+				new (newData + i) T(std::move(this->data[i]));
+				this->data[i].~T();
+			}
+			this->_free();
+			this->data = newData;
+			this->capacity = newCapacity;
+			this->count += size;
+		}
+		/// @brief Constructs new elements at the end.
+		/// @param[in] size Number of new elements.
+		/// @param[in] construct Function that constructs a new element at a target address.
+		template <typename F>
+		inline void _append(size_type size, F construct)
+		{
+			if (this->count + size > this->capacity)
+			{
+				this->_reallocate(hmax(this->capacity * 2, this->count + size), size, construct);
+				return;
+			}
+			size_type oldCount = this->count;
+			try
+			{
+				for (size_type i = 0; i < size; ++i)
+				{
+					construct(this->data + this->count, i);
+					++this->count;
+				}
+			}
+			catch (...)
+			{
+				while (this->count > oldCount)
+				{
+					this->pop_back();
+				}
+				throw;
+			}
+		}
+		/// @brief Moves elements that were appended to a position.
+		/// @param[in] index Target index of the appended elements.
+		/// @param[in] size Number of appended elements.
+		/// @return Iterator of the first moved element.
+		inline iterator _rotateIn(size_type index, size_type size)
+		{
+			std::rotate(this->data + index, this->data + (this->count - size), this->data + this->count);
+			return (this->data + index);
+		}
+
+	};
+
+	/// @brief Encapsulates SmallVector with inline storage for N elements and adds the same high level methods as Array.
+	/// @note No heap memory is allocated until more than N elements are stored, which makes it suitable for small, short-lived collections.
+	/// @note Moving a SmallArray moves its elements one by one if they are in the inline storage.
+	template <typename T, int N>
+	class SmallArray : public Container<SmallVector<T, N>, T>
+	{
+	public:
+		/// @brief Empty constructor.
+		inline SmallArray() :
+			Container<SmallVector<T, N>, T>()
+		{
+		}
+		/// @brief Copy constructor.
+		/// @param[in] other SmallArray to copy.
+		inline SmallArray(const SmallArray<T, N>& other) :
+			Container<SmallVector<T, N>, T>(other)
+		{
+		}
+		/// @brief Move constructor.
+		/// @param[in] other SmallArray to move.
+		inline SmallArray(SmallArray<T, N>&& other) noexcept(std::is_nothrow_move_constructible<T>::value) :
+			Container<SmallVector<T, N>, T>(std::move(other))
+		{
+		}
+		/// @brief Copy constructor.
+		/// @param[in] other Container to copy.
+		inline SmallArray(const Container<SmallVector<T, N>, T>& other) :
+			Container<SmallVector<T, N>, T>()
+		{
+			this->add(other);
+		}
+		/// @brief Constructor from an Array.
+		/// @param[in] other Array to copy.
+		inline explicit SmallArray(const Array<T>& other) :
+			Container<SmallVector<T, N>, T>()
+		{
+			this->_reserve(other.size());
+			for (typename Array<T>::const_iterator_t it = other.begin(), itEnd = other.end(); it != itEnd; ++it)
+			{
+				this->add(*it);
+			}
+		}
+		/// @brief Constructor from single element.
+		/// @param[in] element Element to insert.
+		/// @note The explicit prevents "var = element" from working.
+		inline explicit SmallArray(const T& element) :
+			Container<SmallVector<T, N>, T>()
+		{
+			this->add(element);
+		}
+		/// @brief Constructor from single element.
+		/// @param[in] element Element to insert.
+		/// @param[in] times Number of times to insert element.
+		inline SmallArray(const T& element, int times) :
+			Container<SmallVector<T, N>, T>()
+		{
+			this->_reserve(times);
+			this->add(element, times);
+		}
+		/// @brief Constructor from another Container.
+		/// @param[in] other Container to copy.
+		/// @param[in] count Number of elements to copy.
+		inline SmallArray(const Container<SmallVector<T, N>, T>& other, const int count) :
+			Container<SmallVector<T, N>, T>()
+		{
+			this->add(other, count);
+		}
+		/// @brief Constructor from another Container.
+		/// @param[in] other Container to copy.
+		/// @param[in] start Start index of elements to copy.
+		/// @param[in] count Number of elements to copy.
+		inline SmallArray(const Container<SmallVector<T, N>, T>& other, const int start, const int count) :
+			Container<SmallVector<T, N>, T>()
+		{
+			this->add(other, start, count);
+		}
+		/// @brief Constructor from C-type array.
+		/// @param[in] other C-type array to copy.
+		/// @param[in] count Number of elements to copy.
+		inline SmallArray(const T other[], const int count) :
+			Container<SmallVector<T, N>, T>()
+		{
+			this->_reserve(count);
+			this->add(other, count);
+		}
+		/// @brief Constructor from C-type array.
+		/// @param[in] other C-type array to copy.
+		/// @param[in] start Start index of elements to copy.
+		/// @param[in] count Number of elements to copy.
+		inline SmallArray(const T other[], const int start, const int count) :
+			Container<SmallVector<T, N>, T>()
+		{
+			this->_reserve(count);
+			this->add(other, start, count);
+		}
+		/// @brief Assignment operator.
+		/// @param[in] other SmallArray to copy.
+		/// @return This SmallArray.
+		inline SmallArray<T, N>& operator=(const SmallArray<T, N>& other)
+		{
+			Container<SmallVector<T, N>, T>::operator=(other);
+			return (*this);
+		}
+		/// @brief Move assignment operator.
+		/// @param[in] other SmallArray to move.
+		/// @return This SmallArray.
+		inline SmallArray<T, N>& operator=(SmallArray<T, N>&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+		{
+			Container<SmallVector<T, N>, T>::operator=(std::move(other));
+			return (*this);
+		}
+		/// @brief Copies all elements into an Array.
+		/// @return Array with all elements.
+		inline Array<T> toArray() const
+		{
+			Array<T> result;
+			for (typename SmallArray<T, N>::const_iterator_t it = this->begin(), itEnd = this->end(); it != itEnd; ++it)
+			{
+				result.add(*it);
+			}
+			return result;
+		}
+		/// @brief Gets all indices.
+		/// @return All indices.
+		inline Array<int> indices() const
+		{
+			return this->template _indices<Array<int> >();
+		}
+		/// @brief Gets all indices of the given element.
+		/// @param[in] element Element to search for.
+		/// @return All indices of the given element.
+		inline Array<int> indicesOf(const T& element) const
+		{
+			return this->template _indicesOf<Array<int> >(element);
+		}
+		/// @brief Removes element at given index.
+		/// @param[in] index Index of element to remove.
+		/// @return The removed element.
+		inline T removeAt(int index)
+		{
+			return Container<SmallVector<T, N>, T>::removeAt(index);
+		}
+		/// @brief Removes n elements at given index of SmallArray.
+		/// @param[in] index Start index of elements to remove.
+		/// @param[in] count Number of elements to remove.
+		/// @return SmallArray of all removed elements.
+		/// @note Elements in the returned SmallArray are in the same order as in the orignal SmallArray.
+		inline SmallArray<T, N> removeAt(int index, int count)
+		{
+			return this->template _removeAt<SmallArray<T, N> >(index, count);
+		}
+		/// @brief Removes first element of SmallArray.
+		/// @return The removed element.
+		inline T removeFirst()
+		{
+			return Container<SmallVector<T, N>, T>::removeFirst();
+		}
+		/// @brief Removes n elements from the beginning of SmallArray.
+		/// @param[in] count Number of elements to remove.
+		/// @return SmallArray of all removed elements.
+		/// @note Elements in the returned SmallArray are in the same order as in the orignal SmallArray.
+		inline SmallArray<T, N> removeFirst(const int count)
+		{
+			return this->template _removeFirst<SmallArray<T, N> >(count);
+		}
+		/// @brief Removes last element of SmallArray.
+		/// @return The removed element.
+		inline T removeLast()
+		{
+			return Container<SmallVector<T, N>, T>::removeLast();
+		}
+		/// @brief Removes n elements from the end of SmallArray.
+		/// @param[in] count Number of elements to remove.
+		/// @return SmallArray of all removed elements.
+		/// @note Elements in the returned SmallArray are in the same order as in the orignal SmallArray.
+		inline SmallArray<T, N> removeLast(const int count)
+		{
+			return this->template _removeLast<SmallArray<T, N> >(count);
+		}
+		/// @brief Gets a random element in SmallArray and removes it.
+		/// @return Random element.
+		inline T removeRandom()
+		{
+			return Container<SmallVector<T, N>, T>::removeRandom();
+		}
+		/// @brief Gets an SmallArray of random elements selected from this one and removes them.
+		/// @param[in] count Number of random elements.
+		/// @return SmallArray of random elements selected from this one.
+		inline SmallArray<T, N> removeRandom(const int count)
+		{
+			return this->template _removeRandom<SmallArray<T, N> >(count);
+		}
+		/// @brief Gets a random element in SmallArray.
+		/// @return Random element.
+		inline T random() const
+		{
+			return Container<SmallVector<T, N>, T>::random();
+		}
+		/// @brief Gets an SmallArray of random elements selected from this one.
+		/// @param[in] count Number of random elements.
+		/// @param[in] unique Whether to force all random values to be at unique positions.
+		/// @return SmallArray of random elements selected from this one.
+		inline SmallArray<T, N> random(int count, bool unique = true) const
+		{
+			return this->template _random<SmallArray<T, N> >(count, unique);
+		}
+		/// @brief Creates new SmallArray with reversed order of elements.
+		/// @return A new SmallArray.
+		inline SmallArray<T, N> reversed() const&
+		{
+			return this->template _reversed<SmallArray<T, N> >();
+		}
+		/// @brief Same as reversed(), but modifies this temporary SmallArray in-place instead of copying it.
+		/// @return This SmallArray moved into the result.
+		inline SmallArray<T, N> reversed() &&
+		{
+			this->reverse();
+			return std::move(*this);
+		}
+		/// @brief Creates new SmallArray without duplicates.
+		/// @return A new SmallArray.
+		inline SmallArray<T, N> removedDuplicates() const&
+		{
+			return this->template _removedDuplicates<SmallArray<T, N> >();
+		}
+		/// @brief Same as removedDuplicates(), but modifies this temporary SmallArray in-place instead of copying it.
+		/// @return This SmallArray moved into the result.
+		inline SmallArray<T, N> removedDuplicates() &&
+		{
+			this->removeDuplicates();
+			return std::move(*this);
+		}
+		/// @brief Creates new sorted SmallArray.
+		/// @return A new SmallArray.
+		/// @note The sorting order is ascending.
+		inline SmallArray<T, N> sorted() const&
+		{
+			return this->template _sorted<SmallArray<T, N> >();
+		}
+		/// @brief Same as sorted(), but sorts this temporary SmallArray in-place instead of copying it.
+		/// @return This SmallArray moved into the result.
+		/// @note The sorting order is ascending.
+		inline SmallArray<T, N> sorted() &&
+		{
+			this->sort();
+			return std::move(*this);
+		}
+		/// @brief Creates new sorted SmallArray.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
+		/// @return A new SmallArray.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		template <typename C>
+		inline SmallArray<T, N> sorted(C compareFunction) const&
+		{
+			return this->template _sorted<SmallArray<T, N> >(compareFunction);
+		}
+		/// @brief Same as sorted(compareFunction), but sorts this temporary SmallArray in-place instead of copying it.
+		/// @param[in] compareFunction Comparison function or function object that takes two elements of type T and returns bool.
+		/// @return This SmallArray moved into the result.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		template <typename C>
+		inline SmallArray<T, N> sorted(C compareFunction) &&
+		{
+			this->sort(compareFunction);
+			return std::move(*this);
+		}
+		/// @brief Creates a new SmallArray with randomized order of elements.
+		/// @return A new SmallArray.
+		inline SmallArray<T, N> randomized() const&
+		{
+			return this->template _randomized<SmallArray<T, N> >();
+		}
+		/// @brief Same as randomized(), but modifies this temporary SmallArray in-place instead of copying it.
+		/// @return This SmallArray moved into the result.
+		inline SmallArray<T, N> randomized() &&
+		{
+			this->randomize();
+			return std::move(*this);
+		}
+		/// @brief Creates a new SmallArray as union of this SmallArray with an element.
+		/// @param[in] element Element to unite with.
+		/// @return A new SmallArray.
+		/// @note Removes duplicates.
+		inline SmallArray<T, N> united(const T& element) const
+		{
+			return this->template _united<SmallArray<T, N> >(element);
+		}
+		/// @brief Creates a new SmallArray as union of this SmallArray with another one.
+		/// @param[in] other SmallArray to unite with.
+		/// @return A new SmallArray.
+		/// @note Removes duplicates.
+		inline SmallArray<T, N> united(const SmallArray<T, N>& other) const
+		{
+			return this->template _united<SmallArray<T, N> >(other);
+		}
+		/// @brief Creates a new SmallArray as intersection of this SmallArray with another one.
+		/// @param[in] other SmallArray to intersect with.
+		/// @return A new SmallArray.
+		/// @note Does not remove duplicates.
+		inline SmallArray<T, N> intersected(const SmallArray<T, N>& other) const
+		{
+			return this->template _intersected<SmallArray<T, N> >(other);
+		}
+		/// @brief Creates a new SmallArray as difference of this SmallArray with an element.
+		/// @param[in] element Element to differentiate with.
+		/// @return A new SmallArray.
+		/// @note Unlike remove, this method ignores if the element is not in this SmallArray.
+		/// @note Does not remove duplicates.
+		inline SmallArray<T, N> differentiated(const T& element) const
+		{
+			return this->template _differentiated<SmallArray<T, N> >(element);
+		}
+		/// @brief Creates a new SmallArray as difference of this SmallArray with another one.
+		/// @param[in] other SmallArray to differentiate with.
+		/// @return A new SmallArray.
+		/// @note Unlike remove, this method ignore elements of other SmallArray that are not in this one.
+		/// @note Does not remove duplicates.
+		inline SmallArray<T, N> differentiated(const SmallArray<T, N>& other) const
+		{
+			return this->template _differentiated<SmallArray<T, N> >(other);
+		}
+		/// @brief Creates new SmallArray with new elements obtained from the current SmallArray elements.
+		/// @param[in] generateFunction Function pointer with generation function for the new elements.
+		/// @return A new SmallArray with the new elements.
+		template <typename S>
+		inline SmallArray<S, N> mapped(S (*generateFunction)(T const&)) const
+		{
+			return this->template _mapped<SmallArray<S, N>, S>(generateFunction);
+		}
+		/// @brief Creates new SmallArray with new elements obtained from the current SmallArray elements.
+		/// @param[in] generateFunction Generation function or function object for the new elements.
+		/// @return A new SmallArray with the new elements.
+		/// @note The type of the new elements is the return type of generateFunction.
+		template <typename F>
+		inline auto mapped(F generateFunction) const -> SmallArray<typename std::decay<decltype(generateFunction(std::declval<const T&>()))>::type, N>
+		{
+			typedef typename std::decay<decltype(generateFunction(std::declval<const T&>()))>::type S;
+			return this->template _mapped<SmallArray<S, N>, S>(generateFunction);
+		}
+		/// @brief Finds and returns new SmallArray of elements that match the condition.
+		/// @param[in] conditionFunction Condition function or function object that takes one element of type T and returns bool.
+		/// @return New SmallArray with all matching elements.
+		template <typename C>
+		inline SmallArray<T, N> findAll(C conditionFunction) const
+		{
+			return this->template _findAll<SmallArray<T, N> >(conditionFunction);
+		}
+		/// @brief Returns a new SmallArray with all elements cast into type S.
+		/// @return A new SmallArray with all elements cast into type S.
+		/// @note Make sure all elements in the SmallArray can be cast into type S.
+		template <typename S>
+		inline SmallArray<S, N> cast() const
+		{
+			return this->template _cast<SmallArray<S, N>, S>();
+		}
+		/// @brief Returns a new SmallArray with all elements dynamically cast into type S.
+		/// @param[in] includeNulls Whether to include NULLs that failed to cast.
+		/// @return A new SmallArray with all elements cast into type S.
+		/// @note Be careful not to use this function with non-pointers and classes that don't have virtual functions.
+		template <typename S>
+		inline SmallArray<S, N> dynamicCast(bool includeNulls = false) const
+		{
+			return this->template _dynamicCast<SmallArray<S, N>, S>(includeNulls);
+		}
+		/// @brief Returns element at specified position.
+		/// @param[in] index Index of the element.
+		/// @return Element at specified position.
+		/// @note Does not work with bool as T.
+		inline T& operator[](int index)
+		{
+			return this->at(index);
+		}
+		/// @brief Returns element at specified position.
+		/// @param[in] index Index of the element.
+		/// @return Element at specified position.
+		/// @note Does not work with bool as T.
+		inline const T& operator[](int index) const
+		{
+			return this->at(index);
+		}
+		/// @brief Returns a subarray.
+		/// @param[in] start Start index of the elements to copy.
+		/// @param[in] count Number of elements to copy.
+		/// @return Subarray created from the current SmallArray.
+		inline SmallArray<T, N> operator()(int start, const int count) const
+		{
+			return this->template _sub<SmallArray<T, N> >(start, count);
+		}
+		/// @brief Same as equals.
+		/// @see equals
+		inline bool operator==(const SmallArray<T, N>& other) const
+		{
+			return this->equals(other);
+		}
+		/// @brief Same as nequals.
+		/// @see nequals
+		inline bool operator!=(const SmallArray<T, N>& other) const
+		{
+			return this->nequals(other);
+		}
+		/// @brief Same as add.
+		/// @see add(const T& element)
+		inline SmallArray<T, N>& operator<<(const T& element)
+		{
+			this->add(element);
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(T&& element)
+		inline SmallArray<T, N>& operator<<(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(const SmallArray<T, N>& other)
+		inline SmallArray<T, N>& operator<<(const SmallArray<T, N>& other)
+		{
+			this->add(other);
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(const T& element)
+		inline SmallArray<T, N>& operator+=(const T& element)
+		{
+			this->add(element);
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(T&& element)
+		inline SmallArray<T, N>& operator+=(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(const SmallArray<T, N>& other)
+		inline SmallArray<T, N>& operator+=(const SmallArray<T, N>& other)
+		{
+			this->add(other);
+			return (*this);
+		}
+		/// @brief Same as remove.
+		/// @see remove(T element)
+		inline SmallArray<T, N>& operator-=(T element)
+		{
+			this->remove(element);
+			return (*this);
+		}
+		/// @brief Same as remove.
+		/// @see remove(const SmallArray<T, N>& other)
+		inline SmallArray<T, N>& operator-=(const SmallArray<T, N>& other)
+		{
+			this->remove(other);
+			return (*this);
+		}
+		/// @brief Same as unite.
+		/// @see unite(const T& element)
+		inline SmallArray<T, N>& operator|=(const T& element)
+		{
+			this->unite(element);
+			return (*this);
+		}
+		/// @brief Same as unite.
+		/// @see unite(const SmallArray<T, N>& other)
+		inline SmallArray<T, N>& operator|=(const SmallArray<T, N>& other)
+		{
+			this->unite(other);
+			return (*this);
+		}
+		/// @brief Same as intersect.
+		/// @see intersect(const SmallArray<T, N>& other)
+		inline SmallArray<T, N>& operator&=(const SmallArray<T, N>& other)
+		{
+			this->intersect(other);
+			return (*this);
+		}
+		/// @brief Same as differentiate.
+		/// @see differentiate(const T& element)
+		inline SmallArray<T, N>& operator/=(const T& element)
+		{
+			this->differentiate(element);
+			return (*this);
+		}
+		/// @brief Same as differentiate.
+		/// @see differentiate(const SmallArray<T, N>& other)
+		inline SmallArray<T, N>& operator/=(const SmallArray<T, N>& other)
+		{
+			this->differentiate(other);
+			return (*this);
+		}
+		/// @brief Merges an SmallArray with an element.
+		/// @param[in] element Element to merge with.
+		/// @return New SmallArray with element added at the end of SmallArray.
+		inline SmallArray<T, N> operator+(const T& element) const
+		{
+			SmallArray<T, N> result(*this);
+			result += element;
+			return result;
+		}
+		/// @brief Merges two SmallArrays.
+		/// @param[in] other Second SmallArray to merge with.
+		/// @return New SmallArray with elements of second SmallArray added at the end of first SmallArray.
+		inline SmallArray<T, N> operator+(const SmallArray<T, N>& other) const
+		{
+			SmallArray<T, N> result(*this);
+			result += other;
+			return result;
+		}
+		/// @brief Removes element from SmallArray.
+		/// @param[in] element Element to remove.
+		/// @return New SmallArray with elements of first SmallArray without given element.
+		inline SmallArray<T, N> operator-(T element) const
+		{
+			SmallArray<T, N> result(*this);
+			result -= element;
+			return result;
+		}
+		/// @brief Removes second SmallArray from first SmallArray.
+		/// @param[in] other SmallArray to remove.
+		/// @return New SmallArray with elements of first SmallArray without the elements of second SmallArray.
+		inline SmallArray<T, N> operator-(const SmallArray<T, N>& other) const
+		{
+			SmallArray<T, N> result(*this);
+			result -= other;
+			return result;
+		}
+		/// @brief Same as united.
+		/// @see united(const T& element)
+		inline SmallArray<T, N> operator|(const T& element) const
+		{
+			return this->united(element);
+		}
+		/// @brief Same as united.
+		/// @see united(const SmallArray<T, N>& other)
+		inline SmallArray<T, N> operator|(const SmallArray<T, N>& other) const
+		{
+			return this->united(other);
+		}
+		/// @brief Same as intersected.
+		/// @see intersected(const SmallArray<T, N>& other)
+		inline SmallArray<T, N> operator&(const SmallArray<T, N>& other) const
+		{
+			return this->intersected(other);
+		}
+		/// @brief Same as differentiated.
+		/// @see differentiated(const T& element)
+		inline SmallArray<T, N> operator/(const T& element) const
+		{
+			return this->differentiated(element);
+		}
+		/// @brief Same as differentiated.
+		/// @see differentiated(const SmallArray<T, N>& other)
+		inline SmallArray<T, N> operator/(const SmallArray<T, N>& other) const
+		{
+			return this->differentiated(other);
+		}
+
+		/// @brief Casts this SmallArray into a C-array.
+		/// @return The C-array.
+		inline operator T*()
+		{
+			return &this->operator[](0);
+		}
+		/// @brief Casts this SmallArray into a C-array.
+		/// @return The C-array.
+		inline operator const T*() const
+		{
+			return &this->operator[](0);
+		}
+
+	};
+	
+}
+
+/// @brief Alias for simpler code.
+#define hsmallarray hltypes::SmallArray
+
+#endif
@@ -0,0 +1,132 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides functionality of a spinning mutex for very short critical sections.
+
+#ifndef HLTYPES_SPIN_MUTEX_H
+#define HLTYPES_SPIN_MUTEX_H
+
+#include <atomic>
+
+#include "hltypesExport.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief Provides functionality of a Mutex that busy-waits instead of blocking in the OS.
+	/// @note Only use this for critical sections that take a few instructions, e.g. pushing to a queue. Use Mutex for everything else.
+	/// @note After spinning for a while, waiting threads yield the rest of their time slice so a preempted owner can continue.
+	/// @note It is not recursive.
+	class hltypesExport SpinMutex
+	{
+	public:
+		/// @brief Utility class for exception-safe SpinMutex-locking within a scope.
+		class hltypesExport ScopeLock
+		{
+		public:
+			/// @brief Basic constructor.
+			/// @param[in] mutex The mutex to lock.
+			inline ScopeLock(SpinMutex* mutex = NULL) : mutex(NULL)
+			{
+				this->acquire(mutex);
+			}
+			/// @brief Destructor.
+			inline ~ScopeLock()
+			{
+				this->release();
+			}
+
+			/// @brief Locks the SpinMutex.
+			/// @param[in] mutex The mutex to lock.
+			/// @return True if lock succeeded. False if there is already an assigned SpinMutex.
+			inline bool acquire(SpinMutex* mutex)
+			{
+				if (this->mutex == NULL && mutex != NULL)
+				{
+					this->mutex = mutex;
+					this->mutex->lock();
+					return true;
+				}
+				return false;
+			}
+			/// @brief Unlocks the SpinMutex.
+			/// @return True if unlock succeeded. False if there is no assigned SpinMutex.
+			inline bool release()
+			{
+				if (this->mutex != NULL)
+				{
+					this->mutex->unlock();
+					this->mutex = NULL;
+					return true;
+				}
+				return false;
+			}
+
+		protected:
+			/// @brief The SpinMutex.
+			SpinMutex* mutex;
+
+		};
+
+		/// @brief Basic constructor.
+		/// @param[in] name The internal name.
+		SpinMutex(const String& name = "");
+		/// @brief Destructor.
+		~SpinMutex();
+
+		/// @brief Returns the mutex name.
+		/// @return The mutex name.
+		inline String getName() const { return this->name; }
+
+		/// @brief Locks the SpinMutex.
+		/// @note If another thread has the lock, the caller thread will spin until the previous thread unlocks it.
+		inline void lock()
+		{
+			if (this->locked.exchange(true, std::memory_order_acquire))
+			{
+				this->_lockContended();
+			}
+		}
+		/// @brief Tries to lock the SpinMutex without waiting.
+		/// @return True if the lock was acquired.
+		inline bool tryLock()
+		{
+			return (!this->locked.load(std::memory_order_relaxed) && !this->locked.exchange(true, std::memory_order_acquire));
+		}
+		/// @brief Unlocks the SpinMutex.
+		inline void unlock()
+		{
+			this->locked.store(false, std::memory_order_release);
+		}
+
+	protected:
+		/// @brief Whether the SpinMutex is locked.
+		std::atomic<bool> locked;
+		/// @brief Mutex name.
+		String name;
+
+		/// @brief Spins and yields until the lock is acquired.
+		void _lockContended();
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		SpinMutex(const SpinMutex& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		SpinMutex& operator=(SpinMutex& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::SpinMutex hspinmutex;
+
+#endif
@@ -0,0 +1,164 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides an unbounded lock-free queue for one producer and one consumer thread.
+
+#ifndef HLTYPES_SPSC_QUEUE_H
+#define HLTYPES_SPSC_QUEUE_H
+
+#include <stddef.h>
+#include <utility>
+
+#include "hatomic.h"
+#include "hexception.h"
+
+namespace hltypes
+{
+	/// @brief Unbounded lock-free queue where exactly one thread pushes and exactly one other thread pops.
+	/// @note It is a linked list of nodes. Nodes of popped elements are reused by the producer so allocations only happen while the queue grows.
+	/// @note T has to be default-constructible and movable. Popped nodes keep a moved-from T until they are reused.
+	template <typename T>
+	class SpscQueue
+	{
+	public:
+		/// @brief Empty constructor.
+		SpscQueue() : first(NULL), reusableEnd(NULL), last(NULL)
+		{
+			Node* node = new Node();
+			this->first = node;
+			this->reusableEnd = node;
+			this->last = node;
+			this->consumed.store(node, std::memory_order_relaxed);
+		}
+		/// @brief Destructor.
+		/// @note No other thread may access the queue anymore.
+		~SpscQueue()
+		{
+			Node* node = this->first;
+			Node* next = NULL;
+			while (node != NULL)
+			{
+				next = node->next.load(std::memory_order_relaxed);
+				delete node;
+				node = next;
+			}
+		}
+
+		/// @brief Checks whether the queue is empty.
+		/// @return True if the queue is empty.
+		/// @note Only the consumer gets a reliable result.
+		inline bool isEmpty() const
+		{
+			return (this->consumed.load(std::memory_order_relaxed)->next.load(std::memory_order_acquire) == NULL);
+		}
+
+		/// @brief Adds an element to the end of the queue.
+		/// @param[in] element Element to add.
+		/// @note May only be called from the producer thread.
+		inline void push(const T& element)
+		{
+			T copy(element);
+			this->push(std::move(copy));
+		}
+		/// @brief Adds an element to the end of the queue.
+		/// @param[in] element Element to add, it is moved into the queue.
+		/// @note May only be called from the producer thread.
+		inline void push(T&& element)
+		{
+			Node* node = this->_createNode();
+			node->element = std::move(element);
+			node->next.store(NULL, std::memory_order_relaxed);
+			// publishes the element to the consumer
+			this->last->next.store(node, std::memory_order_release);
+			this->last = node;
+		}
+		/// @brief Removes the first element of the queue.
+		/// @param[out] element The removed element.
+		/// @return False if the queue is empty.
+		/// @note May only be called from the consumer thread.
+		inline bool pop(T& element)
+		{
+			Node* consumed = this->consumed.load(std::memory_order_relaxed);
+			Node* node = consumed->next.load(std::memory_order_acquire);
+			if (node == NULL)
+			{
+				return false;
+			}
+			element = std::move(node->element);
+			// the previously consumed node can now be reused by the producer
+			this->consumed.store(node, std::memory_order_release);
+			return true;
+		}
+
+	protected:
+		/// @brief A node of the linked list.
+		struct Node
+		{
+			/// @brief The next node.
+			Atomic<Node*> next;
+			/// @brief The element.
+			T element;
+
+			inline Node() : next(NULL), element() { }
+		};
+
+		/// @brief Oldest node, only used by the producer. Nodes up to reusableEnd have already been consumed.
+		Node* first;
+		/// @brief Copy of consumed the producer saw last, nodes before it can be reused.
+		Node* reusableEnd;
+		/// @brief Newest node, only used by the producer.
+		Node* last;
+		/// @brief Keeps the consumer data away from the cache line of the producer data.
+		char _padding0[HL_CACHE_LINE_SIZE];
+		/// @brief The last consumed node. Its next node holds the first element of the queue.
+		Atomic<Node*> consumed;
+		/// @brief Keeps the consumer data away from the cache line of following data.
+		char _padding1[HL_CACHE_LINE_SIZE - sizeof(Atomic<Node*>)];
+
+		/// @brief Gets a node for a new element, reusing a consumed one if possible.
+		/// @return The node.
+		inline Node* _createNode()
+		{
+			if (this->first == this->reusableEnd)
+			{
+				this->reusableEnd = this->consumed.load(std::memory_order_acquire);
+				if (this->first == this->reusableEnd)
+				{
+					return new Node();
+				}
+			}
+			Node* node = this->first;
+			this->first = node->next.load(std::memory_order_relaxed);
+			return node;
+		}
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		SpscQueue(const SpscQueue<T>& other)
+		{
+			throw ObjectCannotCopyException("hltypes::SpscQueue");
+		}
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		SpscQueue<T>& operator=(SpscQueue<T>& other)
+		{
+			throw ObjectCannotAssignException("hltypes::SpscQueue");
+			return (*this);
+		}
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+#define hspscqueue hltypes::SpscQueue
+
+#endif
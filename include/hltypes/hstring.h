@@ -16,6 +16,7 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <string>
+#include <utility>
 
 #include "hltypesExport.h"
 
@@ -34,6 +35,7 @@ namespace std
 namespace hltypes
 {
 	template <typename T> class Array;
+	template <typename K, typename V> class Map;
 	
 	/// @brief Encapsulates std::string and adds high level methods.
 	class hltypesExport String : std::basic_string<char>
@@ -54,6 +56,10 @@ namespace hltypes
 		/// @brief Copy constructor.
 		/// @param[in] string String to copy.
 		String(const String& string);
+		/// @brief Move constructor.
+		/// @param[in] string String to move.
+		/// @note The moved String is left empty.
+		String(String&& string) noexcept;
 		/// @brief Copy constructor.
 		/// @param[in] string A C-type string.
 		/// @param[in] length How many characters to copy.
@@ -326,6 +332,11 @@ namespace hltypes
 		/// @param[in] character Character substitution.
 		/// @param[in] times How many times to insert the character.
 		void replace(int position, int count, const char character, int times = 1);
+		/// @brief Replaces occurrences of multiple substrings with their substitutions.
+		/// @param[in] replacements Map of substrings and their substitutions.
+		/// @note All substrings are searched for in a single pass. If multiple substrings match at the same position, the longest one is replaced.
+		/// @note Substituted text is not searched again.
+		void replace(const Map<String, String>& replacements);
 		/// @brief Replaces occurrences of a substring with another substring.
 		/// @param[in] what String substring.
 		/// @param[in] withWhat String substitution.
@@ -393,6 +404,12 @@ namespace hltypes
 		/// @param[in] times How many times to insert the character.
 		/// @return New String.
 		String replaced(int position, int count, const char character, int times = 1) const;
+		/// @brief Replaces occurrences of multiple substrings with their substitutions.
+		/// @param[in] replacements Map of substrings and their substitutions.
+		/// @return New String.
+		/// @note All substrings are searched for in a single pass. If multiple substrings match at the same position, the longest one is replaced.
+		/// @note Substituted text is not searched again.
+		String replaced(const Map<String, String>& replacements) const;
 		/// @brief Inserts a sequence of characters into the String.
 		/// @param[in] position Index where to insert.
 		/// @param[in] string String to insert.
@@ -769,51 +786,56 @@ namespace hltypes
 		/// @brief Converts C-type string into String.
 		/// @param[in] string C-type string value.
 		/// @return This modified String.
-		String operator=(char* string);
+		String& operator=(char* string);
 		/// @brief Converts C-type string into String.
 		/// @param[in] string C-type string value.
 		/// @return This modified String.
-		String operator=(const char* string);
+		String& operator=(const char* string);
 		/// @brief Assigns String to this one.
 		/// @param[in] string String value.
 		/// @return This modified String.
-		String operator=(const String& string);
+		String& operator=(const String& string);
+		/// @brief Moves String into this one.
+		/// @param[in] string String value.
+		/// @return This modified String.
+		/// @note The moved String is left empty.
+		String& operator=(String&& string) noexcept;
 		/// @brief Converts bool into String.
 		/// @param[in] b Bool value.
 		/// @return This modified String.
-		String operator=(const bool b);
+		String& operator=(const bool b);
 		/// @brief Converts short into String.
 		/// @param[in] s Short value.
 		/// @return This modified String.
-		String operator=(const short s);
+		String& operator=(const short s);
 		/// @brief Converts unsigned short into String.
 		/// @param[in] s Unsigned short value.
 		/// @return This modified String.
-		String operator=(const unsigned short s);
+		String& operator=(const unsigned short s);
 		/// @brief Converts int into String.
 		/// @param[in] i Int value.
 		/// @return This modified String.
-		String operator=(const int i);
+		String& operator=(const int i);
 		/// @brief Converts unsigned int into String.
 		/// @param[in] i Unsigned int value.
 		/// @return This modified String.
-		String operator=(const unsigned int i);
+		String& operator=(const unsigned int i);
 		/// @brief Converts 64-bit int into String.
 		/// @param[in] i 64-bit int value.
 		/// @return This modified String.
-		String operator=(const int64_t i);
+		String& operator=(const int64_t i);
 		/// @brief Converts unsigned 64-bit int into String.
 		/// @param[in] i Unsigned 64-bit int value.
 		/// @return This modified String.
-		String operator=(const uint64_t i);
+		String& operator=(const uint64_t i);
 		/// @brief Converts float into String.
 		/// @param[in] f Float value.
 		/// @return This modified String.
-		String operator=(const float f);
+		String& operator=(const float f);
 		/// @brief Converts double into String.
 		/// @param[in] d Double value.
 		/// @return This modified String.
-		String operator=(const double d);
+		String& operator=(const double d);
 		/// @brief Converts char into a String and concatenates the new String at the end of this one.
 		/// @param[in] c Character value.
 		void operator+=(const char c);
@@ -856,19 +878,39 @@ namespace hltypes
 		/// @brief Merges String with a character converted into String first.
 		/// @param[in] c Character value.
 		/// @return New String.
-		String operator+(const char c) const;
+		String operator+(const char c) const&;
+		/// @brief Merges String with a character converted into String first.
+		/// @param[in] c Character value.
+		/// @return New String.
+		/// @note Reuses the buffer of this temporary String instead of copying it.
+		String operator+(const char c) &&;
 		/// @brief Merges String with a C-type string converted into String first.
 		/// @param[in] string C-type string value.
 		/// @return New String.
-		String operator+(char* string) const;
+		String operator+(char* string) const&;
 		/// @brief Merges String with a C-type string converted into String first.
 		/// @param[in] string C-type string value.
 		/// @return New String.
-		String operator+(const char* string) const;
+		/// @note Reuses the buffer of this temporary String instead of copying it.
+		String operator+(char* string) &&;
+		/// @brief Merges String with a C-type string converted into String first.
+		/// @param[in] string C-type string value.
+		/// @return New String.
+		String operator+(const char* string) const&;
+		/// @brief Merges String with a C-type string converted into String first.
+		/// @param[in] string C-type string value.
+		/// @return New String.
+		/// @note Reuses the buffer of this temporary String instead of copying it.
+		String operator+(const char* string) &&;
 		/// @brief Merges String with another String.
 		/// @param[in] string String value.
 		/// @return New String.
-		String operator+(const String& string) const;
+		String operator+(const String& string) const&;
+		/// @brief Merges String with another String.
+		/// @param[in] string String value.
+		/// @return New String.
+		/// @note Reuses the buffer of this temporary String instead of copying it.
+		String operator+(const String& string) &&;
 		/// @brief Compares String for equivalency.
 		/// @param[in] s C-type string value.
 		/// @return True if other String is equal to this one.
@@ -1039,6 +1081,16 @@ namespace hltypes
 		/// @return UTF-8 string.
 		static String fromUnicode(Array<unsigned char> chars);
 
+	protected:
+		/// @brief Replaces occurrences of a substring with another substring.
+		/// @param[in] what Substring.
+		/// @param[in] whatLength Length of the substring.
+		/// @param[in] withWhat Substitution.
+		/// @param[in] withWhatLength Length of the substitution.
+		/// @param[in] times How many times to replace the string maximally. Negative values mean no limit.
+		/// @note All occurrences are found first so the result is allocated with its final size and written in one pass.
+		void _replace(const char* what, int whatLength, const char* withWhat, int withWhatLength, int times);
+
 	};
 }
 
@@ -1067,6 +1119,26 @@ hltypesFnExport inline hltypes::String operator+(char* string1, const hltypes::S
 	result.add(string2.cStr());
 	return result;
 }
+/// @brief Merges a C-type string and a temporary String into a new String.
+/// @param[in] string1 C-type string to merge.
+/// @param[in] string2 Temporary String to merge.
+/// @return Merged String.
+/// @note Reuses the buffer of the temporary String instead of copying it.
+hltypesFnExport inline hltypes::String operator+(const char* string1, hltypes::String&& string2)
+{
+	string2.insertAt(0, string1);
+	return std::move(string2);
+}
+/// @brief Merges a C-type string and a temporary String into a new String.
+/// @param[in] string1 C-type string to merge.
+/// @param[in] string2 Temporary String to merge.
+/// @return Merged String.
+/// @note Reuses the buffer of the temporary String instead of copying it.
+hltypesFnExport inline hltypes::String operator+(char* string1, hltypes::String&& string2)
+{
+	string2.insertAt(0, string1);
+	return std::move(string2);
+}
 /// @brief Applies formatting to a string.
 /// @param[in] format C-type string containing format.
 /// @param[in] args Variable argument list.
@@ -0,0 +1,176 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides a buffer for efficient concatenation of strings.
+
+#ifndef HLTYPES_STRING_BUILDER_H
+#define HLTYPES_STRING_BUILDER_H
+
+#include <stdint.h>
+
+#include "hltypesExport.h"
+#include "hstring.h"
+
+#define MIN_HSTRING_BUILDER_CAPACITY 64
+
+namespace hltypes
+{
+	/// @brief Provides a growable character buffer for building a String from many parts.
+	/// @note Unlike chained String::operator+ calls, parts are appended in-place and the final String is allocated only once in str().
+	class hltypesExport StringBuilder
+	{
+	public:
+		/// @brief Constructor.
+		/// @param[in] initialCapacity Initial capacity of the internal buffer.
+		/// @note initialCapacity is used to prevent unnecessary calls to realloc() internally if it's not needed.
+		StringBuilder(int initialCapacity = MIN_HSTRING_BUILDER_CAPACITY);
+		/// @brief Destructor.
+		~StringBuilder();
+
+		/// @brief Gets the number of characters currently in the buffer.
+		/// @return Number of characters currently in the buffer.
+		inline int size() const { return this->dataSize; }
+		/// @brief Gets the capacity of the internal buffer.
+		/// @return Capacity of the internal buffer.
+		inline int getCapacity() const { return this->capacity; }
+
+		/// @brief Makes sure the internal buffer can hold at least a certain number of characters without reallocation.
+		/// @param[in] newCapacity Minimum capacity of the internal buffer.
+		/// @return True if internal buffer is large enough.
+		/// @note This never shrinks the internal buffer.
+		bool reserve(int newCapacity);
+		/// @brief Clears the content without releasing the internal buffer.
+		void clear();
+
+		/// @brief Appends a character.
+		/// @param[in] c Character value.
+		/// @return This StringBuilder.
+		StringBuilder& add(const char c);
+		/// @brief Appends a character multiple times.
+		/// @param[in] c Character value.
+		/// @param[in] times How many times the character should be added.
+		/// @return This StringBuilder.
+		StringBuilder& add(const char c, int times);
+		/// @brief Appends a C-type string.
+		/// @param[in] string C-type string value.
+		/// @return This StringBuilder.
+		StringBuilder& add(const char* string);
+		/// @brief Appends a C-type string.
+		/// @param[in] string C-type string value.
+		/// @param[in] length Length of the C-type string.
+		/// @return This StringBuilder.
+		StringBuilder& add(const char* string, int length);
+		/// @brief Appends a String.
+		/// @param[in] string String value.
+		/// @return This StringBuilder.
+		StringBuilder& add(const String& string);
+		/// @brief Appends a String.
+		/// @param[in] string String value.
+		/// @param[in] length Length of the String.
+		/// @return This StringBuilder.
+		StringBuilder& add(const String& string, int length);
+		/// @brief Appends a bool converted into a string.
+		/// @param[in] b Bool value.
+		/// @return This StringBuilder.
+		StringBuilder& add(const bool b);
+		/// @brief Appends a short converted into a string.
+		/// @param[in] s Short value.
+		/// @return This StringBuilder.
+		StringBuilder& add(const short s);
+		/// @brief Appends an unsigned short converted into a string.
+		/// @param[in] s Unsigned short value.
+		/// @return This StringBuilder.
+		StringBuilder& add(const unsigned short s);
+		/// @brief Appends an int converted into a string.
+		/// @param[in] i Int value.
+		/// @return This StringBuilder.
+		StringBuilder& add(const int i);
+		/// @brief Appends an unsigned int converted into a string.
+		/// @param[in] i Unsigned int value.
+		/// @return This StringBuilder.
+		StringBuilder& add(const unsigned int i);
+		/// @brief Appends a 64-bit int converted into a string.
+		/// @param[in] i 64-bit int value.
+		/// @return This StringBuilder.
+		StringBuilder& add(const int64_t i);
+		/// @brief Appends an unsigned 64-bit int converted into a string.
+		/// @param[in] i Unsigned 64-bit int value.
+		/// @return This StringBuilder.
+		StringBuilder& add(const uint64_t i);
+		/// @brief Appends a float converted into a string.
+		/// @param[in] f Float value.
+		/// @return This StringBuilder.
+		StringBuilder& add(const float f);
+		/// @brief Appends a float converted into a string.
+		/// @param[in] f Float value.
+		/// @param[in] precision The floating point precision to use.
+		/// @return This StringBuilder.
+		StringBuilder& add(const float f, int precision);
+		/// @brief Appends a double converted into a string.
+		/// @param[in] d Double value.
+		/// @return This StringBuilder.
+		StringBuilder& add(const double d);
+		/// @brief Appends a double converted into a string.
+		/// @param[in] d Double value.
+		/// @param[in] precision The floating point precision to use.
+		/// @return This StringBuilder.
+		StringBuilder& add(const double d, int precision);
+
+		/// @brief Creates a String from the current content.
+		/// @return String with the current content.
+		/// @note The String is allocated only once with the exact size.
+		String str() const;
+		/// @brief Gets the current content as C-string.
+		/// @return The C-string.
+		/// @note The returned pointer is invalidated by any following call that modifies the StringBuilder.
+		const char* cStr() const;
+
+		/// @brief Appends a value.
+		/// @param[in] value The value.
+		/// @return This StringBuilder.
+		/// @see add
+		template <typename T>
+		inline StringBuilder& operator<<(const T& value)
+		{
+			return this->add(value);
+		}
+
+	protected:
+		/// @brief Character buffer.
+		char* data;
+		/// @brief Number of characters in the buffer.
+		int dataSize;
+		/// @brief Capacity of the buffer, not counting the terminating null-character.
+		int capacity;
+
+		/// @brief Makes sure that a certain number of characters can be appended.
+		/// @param[in] count Number of characters.
+		/// @return True if enough space is available.
+		bool _tryIncreaseCapacity(int count);
+		/// @brief Appends raw characters.
+		/// @param[in] string Characters to append.
+		/// @param[in] count Number of characters.
+		void _append(const char* string, int count);
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		StringBuilder(const StringBuilder& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		StringBuilder& operator=(StringBuilder& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::StringBuilder hstrbuilder;
+
+#endif
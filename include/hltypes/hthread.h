@@ -13,6 +13,8 @@
 #ifndef HLTYPES_THREAD_H
 #define HLTYPES_THREAD_H
 
+#include "hatomic.h"
+#include "hevent.h"
 #include "hltypesExport.h"
 #include "hstring.h"
 #include "hltypesUtil.h"
@@ -20,6 +22,7 @@
 namespace hltypes
 {
 	/// @brief Provides functionality of a Thread for multithreading.
+	/// @note To shut a thread down cleanly, call requestCancel() and join(). The thread's function should check isCancelRequested() on the Thread it receives regularly and return when it's set.
 	class hltypesExport Thread
 	{
 	public:
@@ -45,10 +48,32 @@ namespace hltypes
 
 		};
 
+		/// @brief Settings that are applied when a Thread is started.
+		class hltypesExport Attributes
+		{
+		public:
+			/// @brief Stack size in bytes. 0 uses the platform default.
+			int stackSize;
+			/// @brief CPU cores the thread may run on where bit i stands for core i. 0 allows all cores.
+			/// @note Not supported on Apple platforms and UWP.
+			uint64_t affinityMask;
+			/// @brief Scheduling priority as nice value from -20 (highest) to 19 (lowest). 0 is the default.
+			/// @note Raising the priority above the default may require special privileges. On Win32 the value is mapped to the thread priority levels.
+			int priority;
+
+			/// @brief Basic constructor.
+			/// @param[in] stackSize Stack size in bytes. 0 uses the platform default.
+			/// @param[in] affinityMask CPU cores the thread may run on where bit i stands for core i. 0 allows all cores.
+			/// @param[in] priority Scheduling priority as nice value from -20 (highest) to 19 (lowest).
+			inline Attributes(int stackSize = 0, uint64_t affinityMask = 0ULL, int priority = 0) : stackSize(stackSize), affinityMask(affinityMask), priority(priority) { }
+
+		};
+
 		/// @brief Basic constructor.
 		/// @param[in] function Function pointer for the callback.
 		/// @param[in] name Name for the thread.
-		Thread(void (*function)(Thread*), const String& name = "");
+		/// @param[in] attributes Settings that are applied when the thread is started.
+		Thread(void (*function)(Thread*), const String& name = "", const Attributes& attributes = Attributes());
 		/// @brief Destructor.
 		virtual ~Thread();
 
@@ -61,33 +86,61 @@ namespace hltypes
 		/// @brief Gets the thread name.
 		/// @return Thread name.
 		inline String getName() const { return this->name; }
+		/// @brief Gets the settings that are applied when the thread is started.
+		/// @return The settings that are applied when the thread is started.
+		inline Attributes getAttributes() const { return this->attributes; }
+		/// @brief Sets the settings that are applied when the thread is started.
+		/// @param[in] value New settings.
+		/// @note Changes only take effect on the next call of start().
+		inline void setAttributes(const Attributes& value) { this->attributes = value; }
 		/// @brief Gets whether this Thread was started.
 		/// @return True if this Thread was started.
 		inline bool isRunning() const { return this->running; }
 		/// @brief Gets whether the thread is executing right now.
 		/// @return True if the thread is executing right now.
 		inline bool isExecuting() const { return this->executing; }
+		/// @brief Gets whether the thread's function was asked to return early.
+		/// @return True if the thread's function was asked to return early.
+		/// @note The thread's function should check this regularly.
+		inline bool isCancelRequested() const { return this->cancelRequested.load(std::memory_order_acquire); }
 
 		/// @brief Starts the thread processing.
 		void start();
 		/// @brief Stops the thread processing.
+		/// @note This kills the thread forcefully which can leak resources and leave locked mutices behind. Use requestCancel() and join() instead whenever possible.
 		void stop();
 		/// @brief Resumes the thread processing.
 		void resume();
 		/// @brief Pauses the thread processing.
+		/// @note This suspends the thread wherever it is at the moment, possibly while it's holding a lock. It is only supported on Win32.
 		void pause();
+		/// @brief Asks the thread's function to return as soon as possible.
+		/// @note The thread's function has to check isCancelRequested() for this to have any effect. The request is cleared on the next call of start().
+		void requestCancel();
 		/// @brief Joins thread.
+		/// @note If the thread hasn't started executing yet, its function won't be called anymore.
 		void join();
+		/// @brief Waits until the thread's function has returned and joins the thread.
+		/// @param[in] timeout Maximum time to wait in milliseconds.
+		/// @return True if the thread was joined, false if the timeout ran out while the thread was still executing.
+		/// @note Unlike join(), this doesn't prevent a thread that hasn't started executing yet from calling its function.
+		bool join(float timeout);
 		/// @brief Puts current thread to sleep.
 		/// @param[in] milliseconds How long to sleep in milliseconds.
 		static void sleep(float milliseconds);
+		/// @brief Gets the CPU core the calling thread is running on.
+		/// @return Index of the CPU core or -1 if it isn't supported on this platform.
+		/// @note The thread can be moved to another core right afterwards unless its affinity allows only one core.
+		static int getCurrentCore();
 		
 	protected:
 		/// @brief Thread name.
 		/// @note Usually used for debugging purposes.
 		String name;
 		/// @brief Flag that determines whether the thread is executing right now.
-		volatile bool executing;
+		Atomic<bool> executing;
+		/// @brief Settings that are applied when the thread is started.
+		Attributes attributes;
 
 	private:
 		/// @brief Utility for running the thread.
@@ -97,7 +150,11 @@ namespace hltypes
 		/// @brief The internal OS handle ID for the thread.
 		void* id;
 		/// @brief Flag that determines whether this Thread was started.
-		volatile bool running;
+		Atomic<bool> running;
+		/// @brief Flag that determines whether the thread's function was asked to return early.
+		Atomic<bool> cancelRequested;
+		/// @brief Set while the thread isn't executing so threads waiting for it to finish don't have to poll.
+		Event finished;
 
 		/// @brief Copy constructor.
 		/// @note Usage is not allowed and it will throw an exception.
@@ -112,6 +169,9 @@ namespace hltypes
 		void _clear();
 		/// @brief Starts the thread processing.
 		void _platformStart();
+		/// @brief Applies the attributes that can only be set from within the thread.
+		/// @note Called on the new thread before its function.
+		void _platformApplyAttributes();
 		/// @brief Stops the thread processing.
 		void _platformStop();
 		/// @brief Resumes the thread processing.
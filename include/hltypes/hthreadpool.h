@@ -0,0 +1,336 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+/// 
+/// @section DESCRIPTION
+/// 
+/// Provides a pool of worker threads that execute tasks.
+
+#ifndef HLTYPES_THREAD_POOL_H
+#define HLTYPES_THREAD_POOL_H
+
+#include <deque>
+#include <exception>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "harray.h"
+#include "hconditionvariable.h"
+#include "hexception.h"
+#include "hltypesExport.h"
+#include "hltypesUtil.h"
+#include "hmutex.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief Pool of worker threads that execute submitted tasks.
+	/// @note Every worker has its own queue of tasks. Tasks submitted from a worker are added to its own queue and idle workers steal tasks from other queues.
+	/// @note Threads that wait for a task help executing other tasks in the meantime so tasks can safely wait for tasks they submitted themselves.
+	/// @note Idle workers and waiting threads block until there is something to do instead of polling.
+	class hltypesExport ThreadPool
+	{
+	protected:
+		/// @brief State of a task that is shared between the pool and all Futures of the task.
+		class _TaskState
+		{
+		public:
+			/// @brief The pool that executes the task.
+			ThreadPool* pool;
+			/// @brief Whether the task has finished.
+			bool finished;
+			/// @brief Exception thrown by the task.
+			std::exception_ptr exception;
+
+			inline _TaskState(ThreadPool* pool) : pool(pool), finished(false) { }
+			inline virtual ~_TaskState() { }
+
+		};
+
+		/// @brief State of a task with its result.
+		/// @note The result is constructed in place when the task finishes so R doesn't have to be default-constructible.
+		template <typename R>
+		class _ResultState : public _TaskState
+		{
+		public:
+			inline _ResultState(ThreadPool* pool) : _TaskState(pool), hasResult(false) { }
+			inline ~_ResultState()
+			{
+				if (this->hasResult)
+				{
+					((R*)&this->result)->~R();
+				}
+			}
+			/// @brief Calls the task's function and stores the result.
+			template <typename F>
+			inline void execute(F& function)
+			{
+				new (&this->result) R(function());
+				this->hasResult = true;
+			}
+			/// @brief Gets the result.
+			inline R get() const
+			{
+				return *(const R*)&this->result;
+			}
+
+		protected:
+			/// @brief Storage of the result of the task.
+			typename std::aligned_storage<sizeof(R), std::alignment_of<R>::value>::type result;
+			/// @brief Whether the result has been constructed.
+			bool hasResult;
+
+		};
+
+	public:
+		/// @brief Handle of a submitted task that can be used to wait for it and get its result.
+		/// @note Copies refer to the same task. A Future must not be used after its ThreadPool has been destroyed.
+		template <typename R>
+		class Future
+		{
+		public:
+			friend class ThreadPool;
+
+			/// @brief Empty constructor.
+			inline Future()
+			{
+			}
+			/// @brief Checks whether this Future refers to a task.
+			/// @return True if this Future refers to a task.
+			inline bool isValid() const
+			{
+				return (bool)this->state;
+			}
+			/// @brief Checks whether the task has finished.
+			/// @return True if the task has finished. False if it hasn't or if this Future doesn't refer to a task.
+			inline bool isFinished() const
+			{
+				return (this->state && this->state->pool->_isFinished(this->state.get()));
+			}
+			/// @brief Waits until the task has finished.
+			/// @note The calling thread executes other tasks of the pool while waiting.
+			/// @note Throws an exception if this Future doesn't refer to a task.
+			inline void wait() const
+			{
+				if (!this->state)
+				{
+					throw Exception("Cannot wait for a Future that does not refer to a task!");
+				}
+				this->state->pool->_wait(this->state.get());
+			}
+			/// @brief Waits until the task has finished and gets its result.
+			/// @return The result of the task.
+			/// @note If the task threw an exception, it is rethrown here.
+			/// @note Throws an exception if this Future doesn't refer to a task.
+			inline R get() const
+			{
+				this->wait();
+				if (this->state->exception)
+				{
+					std::rethrow_exception(this->state->exception);
+				}
+				return ((_ResultState<R>*)this->state.get())->get();
+			}
+
+		protected:
+			/// @brief The shared state of the task.
+			std::shared_ptr<_TaskState> state;
+
+			inline Future(const std::shared_ptr<_TaskState>& state) : state(state)
+			{
+			}
+
+		};
+
+		/// @brief Basic constructor.
+		/// @param[in] workerCount Number of worker threads. If 0 or less, the number of hardware threads is used.
+		/// @param[in] name Name of the pool, workers are named after it.
+		ThreadPool(int workerCount = 0, const String& name = "hltypes pool");
+		/// @brief Destructor.
+		/// @note Waits until all submitted tasks have finished before the workers are stopped.
+		~ThreadPool();
+
+		/// @brief Gets the pool name.
+		/// @return The pool name.
+		inline String getName() const { return this->name; }
+		/// @brief Gets the number of worker threads.
+		/// @return The number of worker threads.
+		inline int getWorkerCount() const { return this->workers.size(); }
+
+		/// @brief Gets the number of tasks that haven't finished yet.
+		/// @return The number of tasks that haven't finished yet.
+		int getPendingCount();
+
+		/// @brief Submits a task.
+		/// @param[in] function Function or function object without parameters.
+		/// @return Future of the task.
+		/// @note R is the return type of function and has to be copyable unless it's void.
+		template <typename F>
+		inline auto submit(F function) -> Future<decltype(function())>
+		{
+			typedef decltype(function()) R;
+			std::shared_ptr<_TaskState> state(new _ResultState<R>(this));
+			this->_submit(new _FunctionTask<R, F>(state, function));
+			return Future<R>(state);
+		}
+		/// @brief Calls a function for every index in a range using the workers and waits until all calls have finished.
+		/// @param[in] begin First index of the range.
+		/// @param[in] end End index of the range, it is not included.
+		/// @param[in] grain Number of indices that are processed in one task.
+		/// @param[in] function Function or function object that takes an index of type int.
+		/// @note If any call throws an exception, the exception of the first failed task is rethrown after all tasks have finished.
+		template <typename F>
+		inline void parallelFor(int begin, int end, int grain, F function)
+		{
+			grain = hmax(grain, 1);
+			Array<Future<void> > futures;
+			for (int i = begin; i < end; i += grain)
+			{
+				int last = hmin(i + grain, end);
+				F* chunkFunction = &function;
+				futures += this->submit([i, last, chunkFunction]()
+				{
+					for (int j = i; j < last; ++j)
+					{
+						(*chunkFunction)(j);
+					}
+				});
+			}
+			for (typename Array<Future<void> >::iterator_t it = futures.begin(); it != futures.end(); ++it)
+			{
+				it->wait();
+			}
+			for (typename Array<Future<void> >::iterator_t it = futures.begin(); it != futures.end(); ++it)
+			{
+				it->get();
+			}
+		}
+		/// @brief Waits until all submitted tasks have finished.
+		/// @note The calling thread executes tasks of the pool while waiting.
+		void waitAll();
+
+	protected:
+		class Worker;
+		friend class Worker;
+
+		/// @brief A queued task.
+		class _Task
+		{
+		public:
+			/// @brief The shared state of the task.
+			std::shared_ptr<_TaskState> state;
+
+			inline _Task(const std::shared_ptr<_TaskState>& state) : state(state) { }
+			inline virtual ~_Task() { }
+			/// @brief Executes the task.
+			virtual void execute() = 0;
+
+		};
+
+		/// @brief A queued task that calls a function.
+		template <typename R, typename F>
+		class _FunctionTask : public _Task
+		{
+		public:
+			/// @brief The function.
+			F function;
+
+			inline _FunctionTask(const std::shared_ptr<_TaskState>& state, F function) : _Task(state), function(function) { }
+			inline void execute()
+			{
+				((_ResultState<R>*)this->state.get())->execute(this->function);
+			}
+
+		};
+
+		/// @brief Pool name.
+		String name;
+		/// @brief Worker threads.
+		Array<Worker*> workers;
+		/// @brief Tasks submitted from threads that aren't workers of this pool.
+		std::deque<_Task*> tasks;
+		/// @brief Number of tasks that haven't finished yet.
+		int pending;
+		/// @brief Number of tasks that are queued and haven't been taken by any thread yet.
+		int queued;
+		/// @brief Number of threads that are blocked while waiting for tasks to finish.
+		int waiting;
+		/// @brief Whether workers should stop.
+		bool stopping;
+		/// @brief Mutex for the shared queue and the state of the pool and tasks.
+		Mutex mutex;
+		/// @brief Signaled when a task is queued and broadcast when a task finishes while threads are waiting for tasks.
+		ConditionVariable condition;
+
+		/// @brief Queues a task.
+		/// @param[in] task The task.
+		void _submit(_Task* task);
+		/// @brief Takes the next task and executes it.
+		/// @param[in] worker The worker that executes the task or NULL if the calling thread isn't a worker of this pool.
+		/// @return True if a task was executed.
+		bool _executeNext(Worker* worker);
+		/// @brief Takes the next task from the own queue, the shared queue or another worker's queue.
+		/// @param[in] worker The worker that takes the task or NULL if the calling thread isn't a worker of this pool.
+		/// @return The task or NULL if there are no queued tasks.
+		_Task* _take(Worker* worker);
+		/// @brief Executes a task and destroys it.
+		/// @param[in] task The task.
+		void _execute(_Task* task);
+		/// @brief Checks whether a task has finished.
+		/// @param[in] state State of the task.
+		/// @return True if the task has finished.
+		bool _isFinished(_TaskState* state);
+		/// @brief Waits until a task has finished while executing other tasks.
+		/// @param[in] state State of the task.
+		void _wait(_TaskState* state);
+		/// @brief Executes a queued task if there is one or blocks until a task is queued or finishes.
+		/// @param[in] worker The worker of the calling thread or NULL if the calling thread isn't a worker of this pool.
+		/// @param[in] lock ScopeLock that holds the locked mutex of the pool.
+		void _executeOrBlock(Worker* worker, Mutex::ScopeLock* lock);
+		/// @brief Gets the worker of this pool that is executing on the calling thread.
+		/// @return The worker or NULL if the calling thread isn't a worker of this pool.
+		Worker* _getCurrentWorker();
+		/// @brief Updates the number of queued tasks after a task was taken from a worker's queue.
+		void _onTaken();
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		ThreadPool(const ThreadPool& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		ThreadPool& operator=(ThreadPool& other);
+
+	};
+
+	/// @brief State of a task without a result.
+	template <>
+	class ThreadPool::_ResultState<void> : public ThreadPool::_TaskState
+	{
+	public:
+		inline _ResultState(ThreadPool* pool) : _TaskState(pool) { }
+		/// @brief Calls the task's function.
+		template <typename F>
+		inline void execute(F& function)
+		{
+			function();
+		}
+		/// @brief Does nothing since there is no result.
+		inline void get() const
+		{
+		}
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::ThreadPool hthreadpool;
+
+#endif
@@ -0,0 +1,84 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include "hatom.h"
+#include "hhash.h"
+#include "hmap.h"
+#include "hreadwritemutex.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	// function-local statics so Atoms can be safely created during static initialization of other modules
+	static Map<String, void*>& _getTable()
+	{
+		static Map<String, void*> table;
+		return table;
+	}
+
+	static ReadWriteMutex& _getMutex()
+	{
+		static ReadWriteMutex mutex("hltypes::Atom");
+		return mutex;
+	}
+
+	Atom::Atom()
+	{
+		static const Entry* empty = Atom::_intern(String());
+		this->entry = empty;
+	}
+
+	Atom::Atom(const char* string)
+	{
+		this->entry = Atom::_intern(String(string));
+	}
+
+	Atom::Atom(const char* string, int length)
+	{
+		this->entry = Atom::_intern(String(string, length));
+	}
+
+	Atom::Atom(const String& string)
+	{
+		this->entry = Atom::_intern(string);
+	}
+
+	int Atom::getCount()
+	{
+		ReadWriteMutex::ReadScopeLock lock(&_getMutex());
+		return _getTable().size();
+	}
+
+	const Atom::Entry* Atom::_intern(const String& string)
+	{
+		Map<String, void*>& table = _getTable();
+		// most strings are already interned so readers don't have to block each other
+		ReadWriteMutex::ReadScopeLock readLock(&_getMutex());
+		Map<String, void*>::iterator_t it = table.find(string);
+		if (it != table.end())
+		{
+			return (const Entry*)it->second;
+		}
+		readLock.release();
+		ReadWriteMutex::WriteScopeLock lock(&_getMutex());
+		// another thread could have added it in the meantime
+		it = table.find(string);
+		if (it != table.end())
+		{
+			return (const Entry*)it->second;
+		}
+		// entries are intentionally never deleted, handles have to stay valid until the process ends
+		Entry* entry = new Entry();
+		entry->string = string;
+		entry->hash = hashData(string.cStr(), string.size());
+		entry->id = (unsigned int)table.size();
+		table[string] = entry;
+		return entry;
+	}
+
+}
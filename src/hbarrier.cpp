@@ -0,0 +1,55 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include "hbarrier.h"
+#include "hconditionvariable.h"
+#include "hexception.h"
+#include "hltypesUtil.h"
+#include "hmutex.h"
+
+namespace hltypes
+{
+	Barrier::Barrier(int count, const String& name) : name(name), count(hmax(count, 1)), arrived(0), generation(0), mutex(name), condition(name)
+	{
+	}
+
+	Barrier::~Barrier()
+	{
+	}
+
+	bool Barrier::wait()
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		unsigned int generation = this->generation;
+		++this->arrived;
+		if (this->arrived >= this->count)
+		{
+			this->arrived = 0;
+			++this->generation;
+			this->condition.broadcast();
+			return true;
+		}
+		while (generation == this->generation)
+		{
+			this->condition.wait(&lock);
+		}
+		return false;
+	}
+
+	Barrier::Barrier(const Barrier& other)
+	{
+		throw ObjectCannotCopyException("hltypes::Barrier");
+	}
+
+	Barrier& Barrier::operator=(Barrier& other)
+	{
+		throw ObjectCannotAssignException("hltypes::Barrier");
+		return (*this);
+	}
+
+}
@@ -0,0 +1,140 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#ifndef _WIN32
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#endif
+#include <stdlib.h>
+
+#define __HL_INCLUDE_PLATFORM_HEADERS
+#include "hconditionvariable.h"
+#include "hexception.h"
+#include "hlog.h"
+#include "hltypesUtil.h"
+#include "hmutex.h"
+#include "hplatform.h"
+
+namespace hltypes
+{
+	ConditionVariable::ConditionVariable(const String& name) :
+		handle(NULL)
+	{
+		this->name = name;
+#ifdef _WIN32
+		this->handle = (CONDITION_VARIABLE*)malloc(sizeof(CONDITION_VARIABLE));
+		if (this->handle != NULL)
+		{
+			InitializeConditionVariable((CONDITION_VARIABLE*)this->handle);
+		}
+		else
+		{
+			hlog::error(logTag, "Could not allocate enough memory condition variable handle!");
+		}
+#else
+		this->handle = (pthread_cond_t*)malloc(sizeof(pthread_cond_t));
+#ifndef __APPLE__ // Apple doesn't support a monotonic clock for condition variables, but has relative timeouts instead
+		pthread_condattr_t attributes;
+		pthread_condattr_init(&attributes);
+		pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+		pthread_cond_init((pthread_cond_t*)this->handle, &attributes);
+		pthread_condattr_destroy(&attributes);
+#else
+		pthread_cond_init((pthread_cond_t*)this->handle, 0);
+#endif
+#endif
+	}
+
+	ConditionVariable::~ConditionVariable()
+	{
+#ifdef _WIN32
+		// Win32 condition variables don't need to be deleted
+		free((CONDITION_VARIABLE*)this->handle);
+#else
+		pthread_cond_destroy((pthread_cond_t*)this->handle);
+		free((pthread_cond_t*)this->handle);
+#endif
+	}
+
+	void ConditionVariable::wait(Mutex::ScopeLock* lock)
+	{
+		Mutex* mutex = lock->mutex;
+		if (mutex == NULL)
+		{
+			return;
+		}
+#ifdef _WIN32
+		mutex->locked.store(false, std::memory_order_relaxed);
+		SleepConditionVariableCS((CONDITION_VARIABLE*)this->handle, (CRITICAL_SECTION*)mutex->handle, INFINITE);
+		mutex->locked.store(true, std::memory_order_relaxed);
+#else
+		pthread_cond_wait((pthread_cond_t*)this->handle, (pthread_mutex_t*)mutex->handle);
+#endif
+	}
+
+	bool ConditionVariable::wait(Mutex::ScopeLock* lock, float timeout)
+	{
+		Mutex* mutex = lock->mutex;
+		if (mutex == NULL)
+		{
+			return false;
+		}
+		timeout = hmax(timeout, 0.0f);
+#ifdef _WIN32
+		mutex->locked.store(false, std::memory_order_relaxed);
+		BOOL result = SleepConditionVariableCS((CONDITION_VARIABLE*)this->handle, (CRITICAL_SECTION*)mutex->handle, (DWORD)timeout);
+		mutex->locked.store(true, std::memory_order_relaxed);
+		return (result != 0);
+#else
+		struct timespec time;
+		int64_t nanoseconds = (int64_t)(timeout * 1000000.0f);
+#ifndef __APPLE__
+		clock_gettime(CLOCK_MONOTONIC, &time);
+		nanoseconds += time.tv_nsec;
+		time.tv_sec += (time_t)(nanoseconds / 1000000000LL);
+		time.tv_nsec = (long)(nanoseconds % 1000000000LL);
+		return (pthread_cond_timedwait((pthread_cond_t*)this->handle, (pthread_mutex_t*)mutex->handle, &time) != ETIMEDOUT);
+#else
+		time.tv_sec = (time_t)(nanoseconds / 1000000000LL);
+		time.tv_nsec = (long)(nanoseconds % 1000000000LL);
+		return (pthread_cond_timedwait_relative_np((pthread_cond_t*)this->handle, (pthread_mutex_t*)mutex->handle, &time) != ETIMEDOUT);
+#endif
+#endif
+	}
+
+	void ConditionVariable::signal()
+	{
+#ifdef _WIN32
+		WakeConditionVariable((CONDITION_VARIABLE*)this->handle);
+#else
+		pthread_cond_signal((pthread_cond_t*)this->handle);
+#endif
+	}
+
+	void ConditionVariable::broadcast()
+	{
+#ifdef _WIN32
+		WakeAllConditionVariable((CONDITION_VARIABLE*)this->handle);
+#else
+		pthread_cond_broadcast((pthread_cond_t*)this->handle);
+#endif
+	}
+
+	ConditionVariable::ConditionVariable(const ConditionVariable& other)
+	{
+		throw ObjectCannotCopyException("hltypes::ConditionVariable");
+	}
+
+	ConditionVariable& ConditionVariable::operator=(ConditionVariable& other)
+	{
+		throw ObjectCannotAssignException("hltypes::ConditionVariable");
+		return (*this);
+	}
+
+}
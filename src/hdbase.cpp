@@ -9,8 +9,11 @@
 #include "harray.h"
 #include "hdbase.h"
 #include "hlog.h"
+#include "hltypesUtil.h"
 #include "hplatform.h"
+#include "hsmallarray.h"
 #include "hstring.h"
+#include "hstringbuilder.h"
 #include "platform_internal.h"
 
 namespace hltypes
@@ -48,10 +51,18 @@ namespace hltypes
 #ifdef _DEBUG // using _platformPrint() directory to avoid possible deadlock when saving to file during logging
 			hltypes::_platformPrint(logTag, "The path '" + result + "' contains multiple consecutive '/' (slash) characters. It will be systemized properly, but you may want to consider fixing this.", Log::LevelWarn);
 #endif
-			for (int i = 0; i < 1000 && result.contains("//"); ++i) // 1000 loops are there to prevent a possible infinite loop
+			// collapsing all runs of slashes in a single pass
+			const char* data = result.cStr();
+			int size = result.size();
+			StringBuilder builder(size);
+			for_iter (i, 0, size)
 			{
-				result.replace("//", "/");
+				if (data[i] != '/' || i == 0 || data[i - 1] != '/')
+				{
+					builder.add(data[i]);
+				}
 			}
+			result = builder.str();
 		}
 #ifdef _WIN32
 		// there could still be a single leading slash
@@ -70,39 +81,28 @@ namespace hltypes
 	String DirBase::normalize(const String& path)
 	{
 		Array<String> directories = DirBase::splitPath(path);
-		Array<String> result;
-		while (directories.size() > 0)
+		// paths rarely have more than a few segments so this usually doesn't need to allocate anything
+		SmallArray<String, 16> result;
+		foreachc (String, it, directories)
 		{
-			if (directories.first() == ".")
+			if ((*it) == ".")
 			{
-				directories.removeFirst();
+				continue;
 			}
-			else if (directories.first() == "..")
+			if ((*it) == ".." && result.size() > 0 && result.last() != "..")
 			{
-				if (result.size() == 0)
-				{
-					result += directories.removeFirst();
-				}
-				else if (result.last() == "..")
-				{
-					result += directories.removeFirst();
-				}
-				else
-				{
-					result.removeLast();
-					directories.removeFirst();
-				}
+				result.removeLast();
 			}
 			else
 			{
-				result += directories.removeFirst();
+				result += (*it);
 			}
 		}
 		if (result.size() == 0)
 		{
 			return ".";
 		}
-		return DirBase::joinPaths(result);
+		return DirBase::systemize(result.joined("/"));
 	}
 		
 	String DirBase::joinPath(const String& path1, const String& path2, bool systemizeResult)
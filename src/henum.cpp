@@ -27,21 +27,22 @@ namespace hltypes
 
 	String Enumeration::getName() const
 	{
-		Map<unsigned int, String>& instances = this->_getInstances();
-		if (!instances.hasKey(value))
+		const Map<unsigned int, String>& instances = this->_getInstances().getForward();
+		Map<unsigned int, String>::const_iterator_t it = instances.find(this->value);
+		if (it == instances.end())
 		{
-			throw EnumerationValueNotExistsException(value);
+			throw EnumerationValueNotExistsException(this->value);
 		}
-		return instances[this->value];
+		return it->second;
 	}
 
 	void Enumeration::_addNewInstance(const String& className, const String& name)
 	{
 		String newName = name;
-		Map<unsigned int, String>& instances = this->_getInstances();
+		const Map<unsigned int, String>& instances = this->_getInstances().getForward();
 		if (instances.size() > 0)
 		{
-			this->value = instances.keys().max() + 1;
+			this->value = instances.rbegin()->first + 1;
 		}
 		if (newName == "")
 		{
@@ -52,12 +53,17 @@ namespace hltypes
 
 	void Enumeration::_addNewInstance(const String& className, const String& name, unsigned int value)
 	{
-		Map<unsigned int, String>& instances = this->_getInstances();
+		BiMap<unsigned int, String>& instances = this->_getInstances();
 		if (instances.hasKey(value))
 		{
 			throw EnumerationValueAlreadyExistsException(value);
 		}
-		instances[this->value] = name;
+		// names have to be unique as well, because the name index maps each name to exactly one value
+		if (instances.hasValue(name))
+		{
+			throw EnumerationNameAlreadyExistsException(name);
+		}
+		instances.insert(this->value, name);
 #if defined(_DEBUG) && defined(_DEBUG_PRINT_HENUM)
 		// because of the order of global var initializations, mutexes get messed up
 		printf("[hltypes] Adding enum '%s::%s' under value '%u'.\n", className.cStr(), name.cStr(), this->value);
@@ -0,0 +1,98 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include "hconditionvariable.h"
+#include "hevent.h"
+#include "hexception.h"
+#include "hltypesUtil.h"
+#include "hmutex.h"
+
+namespace hltypes
+{
+	Event::Event(bool autoReset, const String& name) : name(name), autoReset(autoReset), state(false), mutex(name), condition(name)
+	{
+	}
+
+	Event::~Event()
+	{
+	}
+
+	bool Event::isSet()
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		return this->state;
+	}
+
+	void Event::set()
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		this->state = true;
+		if (this->autoReset)
+		{
+			this->condition.signal();
+		}
+		else
+		{
+			this->condition.broadcast();
+		}
+	}
+
+	void Event::reset()
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		this->state = false;
+	}
+
+	void Event::wait()
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		while (!this->state)
+		{
+			this->condition.wait(&lock);
+		}
+		if (this->autoReset)
+		{
+			this->state = false;
+		}
+	}
+
+	bool Event::wait(float timeout)
+	{
+		int64_t end = htickCount() + (int64_t)timeout;
+		Mutex::ScopeLock lock(&this->mutex);
+		while (!this->state)
+		{
+			int64_t remaining = end - htickCount();
+			if (remaining <= 0 || !this->condition.wait(&lock, (float)remaining))
+			{
+				if (!this->state)
+				{
+					return false;
+				}
+				break;
+			}
+		}
+		if (this->autoReset)
+		{
+			this->state = false;
+		}
+		return true;
+	}
+
+	Event::Event(const Event& other)
+	{
+		throw ObjectCannotCopyException("hltypes::Event");
+	}
+
+	Event& Event::operator=(Event& other)
+	{
+		throw ObjectCannotAssignException("hltypes::Event");
+		return (*this);
+	}
+
+}
@@ -15,17 +15,26 @@
 #include "hfile.h"
 #include "hlog.h"
 #include "hltypesUtil.h"
+#include "hmutex.h"
 #include "hplatform.h"
 #include "hrdir.h"
 #include "hresource.h"
 #include "hstring.h"
+#include "hstringbuilder.h"
 #include "platform_internal.h"
 
 namespace hltypes
 {
-	_Exception::_Exception(const String& message, const char* sourceFile, int lineNumber)
+	Atomic<bool> _Exception::stackTraceEnabled(true);
+
+	_Exception::_Exception(const String& message, const char* sourceFile, int lineNumber) :
+		stackTraceResolved(false),
+		stackFrameCount(0)
 	{
-		this->stackTrace = hstackTrace();
+		if (_Exception::stackTraceEnabled.load(std::memory_order_relaxed))
+		{
+			this->stackFrameCount = hstackCapture(this->stackFrames, HL_EXCEPTION_STACK_FRAMES);
+		}
 		this->_setInternalMessage(message, sourceFile, lineNumber);
 	}
 	
@@ -33,10 +42,45 @@ namespace hltypes
 	{
 	}
 
+	String _Exception::getStackTrace() const
+	{
+		// exceptions can be rethrown in several threads through std::exception_ptr so resolving has to be guarded
+		static Mutex resolveMutex("hltypes::Exception::stackTrace");
+		Mutex::ScopeLock lock(&resolveMutex);
+		if (!this->stackTraceResolved)
+		{
+			this->stackTrace = hstackResolve(this->stackFrames, this->stackFrameCount);
+			this->stackTraceResolved = true;
+		}
+		return this->stackTrace;
+	}
+
+	void _Exception::setStackTraceEnabled(bool value)
+	{
+		_Exception::stackTraceEnabled.store(value, std::memory_order_relaxed);
+	}
+
+	bool _Exception::isStackTraceEnabled()
+	{
+		return _Exception::stackTraceEnabled.load(std::memory_order_relaxed);
+	}
+
 	void _Exception::_setInternalMessage(const String& message, const char* sourceFile, int lineNumber)
 	{
 		this->rawMessage = message;
-		this->message = "[" + Dir::baseName(sourceFile) + ":" + hstr(lineNumber) + "] " + message;
+		// only the base name of the source file is needed, Dir::baseName() would normalize the whole path first
+		const char* baseName = sourceFile;
+		const char* end = sourceFile;
+		for (; *end != '\0'; ++end)
+		{
+			if (*end == '/' || *end == '\\')
+			{
+				baseName = end + 1;
+			}
+		}
+		StringBuilder builder((int)(end - baseName) + message.size() + 16);
+		builder.add('[').add(baseName).add(':').add(lineNumber).add("] ").add(message);
+		this->message = builder.str();
 		// because Visual Studio on UWP cannot properly display exceptions and stack traces for some reason even though it should
 		// because Android doesn't display register data properly if an exception is thrown
 #if defined(_WIN32) || defined(__ANDROID__) || defined(_IOS)
@@ -45,7 +89,7 @@ namespace hltypes
 #ifndef __ANDROID__
 			hltypes::_platformPrint("FATAL", this->message, Log::LevelError);
 #else
-			hltypes::_platformPrint("FATAL", this->message + "\n" + this->stackTrace, Log::LevelError);
+			hltypes::_platformPrint("FATAL", this->message + "\n" + this->getStackTrace(), Log::LevelError);
 #endif
 		}
 #endif
@@ -192,4 +236,10 @@ namespace hltypes
 		this->_setInternalMessage("enum value already exists: " + hstr(value), sourceFile, lineNumber);
 	}
 
+	_EnumerationNameAlreadyExistsException::_EnumerationNameAlreadyExistsException(const String& name, const char* sourceFile, int lineNumber) :
+		_Exception("", sourceFile, lineNumber)
+	{
+		this->_setInternalMessage("enum name already exists: " + name, sourceFile, lineNumber);
+	}
+
 }
@@ -47,14 +47,18 @@ namespace hltypes
 
 	FileBase::FileBase(const String& filename) :
 		StreamBase(),
-		cfile(NULL)
+		cfile(NULL),
+		positionalHandle(NULL),
+		writable(false)
 	{
 		this->filename = Dir::normalize(filename);
 	}
 	
 	FileBase::FileBase() :
 		StreamBase(),
-		cfile(NULL)
+		cfile(NULL),
+		positionalHandle(NULL),
+		writable(false)
 	{
 	}
 	
@@ -151,11 +155,17 @@ namespace hltypes
 		{
 			throw FileCouldNotOpenException(this->_descriptor());
 		}
+		this->writable = (accessMode != AccessMode::Read);
 	}
 	
 	void FileBase::_fclose()
 	{
 		this->_validate();
+		void* positionalHandle = this->positionalHandle.exchange(NULL);
+		if (positionalHandle != NULL)
+		{
+			_platformClosePositionalFile(positionalHandle);
+		}
 		_platformCloseFile(this->cfile);
 		this->cfile = NULL;
 		this->dataSize = 0;
@@ -169,10 +179,55 @@ namespace hltypes
 	int FileBase::_fwrite(const void* buffer, int count)
 	{
 		int result = (int)_platformWriteFile(buffer, 1, count, (FILE*)this->cfile);
-		this->dataSize = hmax(this->dataSize, this->_fposition());
+		this->_growDataSize(this->_fposition());
 		return result;
 	}
 	
+	void* FileBase::_getPositionalHandle()
+	{
+		void* handle = this->positionalHandle.load(std::memory_order_acquire);
+		if (handle == NULL)
+		{
+			void* newHandle = _platformOpenPositionalFile(this->filename, this->writable);
+			if (newHandle != NULL)
+			{
+				// another thread may have opened a handle in the meantime
+				if (this->positionalHandle.compareExchange(handle, newHandle, std::memory_order_acq_rel, std::memory_order_acquire))
+				{
+					handle = newHandle;
+				}
+				else
+				{
+					_platformClosePositionalFile(newHandle);
+				}
+			}
+		}
+		return handle;
+	}
+
+	int FileBase::_freadAt(int64_t offset, void* buffer, int count)
+	{
+		return _platformReadFileAt(buffer, count, offset, this->cfile, this->_getPositionalHandle());
+	}
+	
+	int FileBase::_fwriteAt(int64_t offset, const void* buffer, int count)
+	{
+		int result = _platformWriteFileAt(buffer, count, offset, this->cfile, this->_getPositionalHandle());
+		if (result > 0)
+		{
+			this->_growDataSize(offset + result);
+		}
+		return result;
+	}
+
+	void FileBase::_growDataSize(int64_t size)
+	{
+		int64_t current = this->dataSize.load(std::memory_order_relaxed);
+		while (current < size && !this->dataSize.compareExchangeWeak(current, size, std::memory_order_relaxed))
+		{
+		}
+	}
+	
 	bool FileBase::_fisOpen() const
 	{
 		return (this->cfile != NULL);
@@ -11,12 +11,14 @@
 #include "hexception.h"
 #include "hfile.h"
 #include "hlog.h"
+#include "hparallel.h"
 #include "hplatform.h"
 #include "hstring.h"
 #include "hthread.h"
 #include "platform_internal.h"
 
 #define BUFFER_SIZE 65536
+#define ASYNC_POOL_MIN_WORKERS 4
 
 namespace hltypes
 {
@@ -52,6 +54,35 @@ namespace hltypes
 		this->_fclose();
 	}
 	
+	int File::readAt(int64_t offset, void* buffer, int count)
+	{
+		this->_validate();
+		return this->_freadAt(offset, buffer, count);
+	}
+
+	int File::writeAt(int64_t offset, const void* buffer, int count)
+	{
+		this->_validate();
+		return this->_fwriteAt(offset, buffer, count);
+	}
+
+	ThreadPool::Future<int> File::readAsync(int64_t offset, void* buffer, int count)
+	{
+		this->_validate();
+		File* file = this;
+		return File::_getAsyncPool()->submit([file, offset, buffer, count]()
+		{
+			return file->_freadAt(offset, buffer, count);
+		});
+	}
+
+	ThreadPool* File::_getAsyncPool()
+	{
+		// never destroyed so reads can't outlive their pool, workers are stopped with the process
+		static ThreadPool* pool = new ThreadPool(hmax(Parallel::getConcurrency() * 2, ASYNC_POOL_MIN_WORKERS), "hltypes file io");
+		return pool;
+	}
+
 	int File::_read(void* buffer, int count)
 	{
 		return this->_fread(buffer, count);
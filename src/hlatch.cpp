@@ -0,0 +1,79 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include "hconditionvariable.h"
+#include "hexception.h"
+#include "hlatch.h"
+#include "hltypesUtil.h"
+#include "hmutex.h"
+
+namespace hltypes
+{
+	Latch::Latch(int count, const String& name) : name(name), count(hmax(count, 0)), mutex(name), condition(name)
+	{
+	}
+
+	Latch::~Latch()
+	{
+	}
+
+	int Latch::getCount()
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		return this->count;
+	}
+
+	void Latch::countDown(int amount)
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		if (this->count > 0)
+		{
+			this->count = hmax(this->count - amount, 0);
+			if (this->count == 0)
+			{
+				this->condition.broadcast();
+			}
+		}
+	}
+
+	void Latch::wait()
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		while (this->count > 0)
+		{
+			this->condition.wait(&lock);
+		}
+	}
+
+	bool Latch::wait(float timeout)
+	{
+		int64_t end = htickCount() + (int64_t)timeout;
+		Mutex::ScopeLock lock(&this->mutex);
+		while (this->count > 0)
+		{
+			int64_t remaining = end - htickCount();
+			if (remaining <= 0 || !this->condition.wait(&lock, (float)remaining))
+			{
+				return (this->count == 0);
+			}
+		}
+		return true;
+	}
+
+	Latch::Latch(const Latch& other)
+	{
+		throw ObjectCannotCopyException("hltypes::Latch");
+	}
+
+	Latch& Latch::operator=(Latch& other)
+	{
+		throw ObjectCannotAssignException("hltypes::Latch");
+		return (*this);
+	}
+
+}
@@ -164,81 +164,101 @@ hltypes::String henv(const hltypes::String& name)
 }
 
 #ifdef __ANDROID__
-struct StackFrame
+struct StackFrames
 {
-	hltypes::Array<void*> addresses;
-	hltypes::Array<hltypes::String> names;
+	void** addresses;
+	int count;
 	int maxFrames;
 };
 
 static _Unwind_Reason_Code _traceFunction(struct _Unwind_Context* context, void* arg)
 {
-	StackFrame* frame = (StackFrame*)arg;
+	StackFrames* frames = (StackFrames*)arg;
 	void* ip = (void*)_Unwind_GetIP(context);
 	if (ip != NULL)
 	{
-		frame->addresses += ip;
-		Dl_info info;
-		memset(&info, 0, sizeof(Dl_info));
-		hstr name = "unknown";
-		if (dladdr(ip, &info) != 0)
-		{
-			if (info.dli_sname != NULL)
-			{
-				name = hstr(info.dli_sname);
-			}
-			name += " (" + hstr(info.dli_fname) + ")";
-		}
-		frame->names += name;
+		frames->addresses[frames->count] = ip;
+		++frames->count;
 	}
-	return (frame->addresses.size() < frame->maxFrames ? _URC_NO_REASON : _URC_END_OF_STACK);
+	return (frames->count < frames->maxFrames ? _URC_NO_REASON : _URC_END_OF_STACK);
 }
 #endif
 
-hltypes::String hstackTrace(int maxFrames)
+int hstackCapture(void** frames, int maxFrames)
+{
+	int result = 0;
+	maxFrames = hmin(maxFrames, MAX_STACK_FRAMES);
+	if (maxFrames <= 0)
+	{
+		return result;
+	}
+#if defined(_WIN32) && !defined(_UWP) // doesn't work on UWP
+	result = (int)RtlCaptureStackBackTrace(1, maxFrames, frames, NULL); // skipping this function call from the stack trace
+#elif defined(__ANDROID__)
+	void* addresses[MAX_STACK_FRAMES + 1];
+	StackFrames stackFrames;
+	stackFrames.addresses = addresses;
+	stackFrames.count = 0;
+	stackFrames.maxFrames = maxFrames + 1;
+	_Unwind_Backtrace(&_traceFunction, &stackFrames);
+	result = hmax(stackFrames.count - 1, 0); // skipping this function call from the stack trace
+	if (result > 0)
+	{
+		memcpy(frames, &addresses[1], result * sizeof(void*));
+	}
+#endif
+	return result;
+}
+
+hltypes::String hstackResolve(void* const* frames, int count)
 {
-	// the implementations on some platforms are not thread-safe
-	static hltypes::Mutex stackMutex;
-	hltypes::Mutex::ScopeLock lock(&stackMutex);
-	// get stack trace
 	hltypes::String result = "Stack trace not available on this platform!";
 #if defined(_WIN32) && !defined(_UWP) // doesn't work on UWP
-	maxFrames = hclamp(maxFrames, 1, MAX_STACK_FRAMES);
 	result = "Could not obtain stack trace!";
+	if (count <= 0)
+	{
+		return result;
+	}
+	// DbgHelp functions are not thread-safe
+	static hltypes::Mutex stackMutex;
+	hltypes::Mutex::ScopeLock lock(&stackMutex);
 	HANDLE process = GetCurrentProcess();
 	if (process != NULL)
 	{
 		if (SymInitialize(process, NULL, TRUE))
 		{
-			void* stack[100];
-			unsigned short frames = RtlCaptureStackBackTrace(1, maxFrames, stack, NULL); // skipping this function call from the stack trace
-			if (frames > 0)
+			hltypes::Array<hltypes::String> calls;
+			PSYMBOL_INFO symbol = (PSYMBOL_INFO)malloc(sizeof(SYMBOL_INFO) + MAX_STACK_ADDRESS_NAME_SIZE * sizeof(char));
+			symbol->MaxNameLen = MAX_STACK_ADDRESS_NAME_SIZE + 1;
+			symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+			for_iter (i, 0, count)
 			{
-				hltypes::Array<hltypes::String> calls;
-				PSYMBOL_INFO symbol = (PSYMBOL_INFO)malloc(sizeof(SYMBOL_INFO) + MAX_STACK_ADDRESS_NAME_SIZE * sizeof(char));
-				symbol->MaxNameLen = MAX_STACK_ADDRESS_NAME_SIZE + 1;
-				symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
-				for_iter (i, 0, frames)
-				{
-					SymFromAddr(process, (DWORD64)stack[i], 0, symbol);
-					calls += hsprintf("0x%0llX - %s\n", symbol->Address, symbol->Name);
-				}
-				free(symbol);
-				result = calls.joined("");
+				SymFromAddr(process, (DWORD64)frames[i], 0, symbol);
+				calls += hsprintf("0x%0llX - %s\n", symbol->Address, symbol->Name);
 			}
+			free(symbol);
+			result = calls.joined("");
 		}
 		SymCleanup(process);
 	}
 #elif defined(__ANDROID__)
-	maxFrames = hclamp(maxFrames, 1, MAX_STACK_FRAMES);
 	result = "Could not obtain stack trace!";
-	StackFrame frame;
-	frame.maxFrames = maxFrames;
-	_Unwind_Backtrace(&_traceFunction, &frame);
 	hltypes::Array<hltypes::String> calls;
-	for_iter (i, 1, frame.addresses.size()) // skipping this function call from the stack trace
+	Dl_info info;
+	hstr name;
+	for_iter (i, 0, count)
 	{
-		calls += hsprintf("%p - %s\n", frame.addresses[i], frame.names[i].cStr());
+		memset(&info, 0, sizeof(Dl_info));
+		name = "unknown";
+		if (dladdr(frames[i], &info) != 0)
+		{
+			if (info.dli_sname != NULL)
+			{
+				name = hstr(info.dli_sname);
+			}
+			name += " (" + hstr(info.dli_fname) + ")";
+		}
+		calls += hsprintf("%p - %s\n", frames[i], name.cStr());
 	}
 	if (calls.size() > 0)
 	{
@@ -248,6 +268,15 @@ hltypes::String hstackTrace(int maxFrames)
 	return result;
 }
 
+hltypes::String hstackTrace(int maxFrames)
+{
+	void* frames[MAX_STACK_FRAMES];
+	maxFrames = hclamp(maxFrames, 1, MAX_STACK_FRAMES - 1);
+	// one more frame, because this function call is skipped from the stack trace
+	int count = hstackCapture(frames, maxFrames + 1);
+	return hstackResolve(&frames[1], hmax(count - 1, 0));
+}
+
 uint64_t getFreeDiskSpace()
 {
 	uint64_t result = 0ULL;
@@ -85,7 +85,7 @@ namespace hltypes
 	{
 #ifdef _WIN32
 		EnterCriticalSection((CRITICAL_SECTION*)this->handle);
-		if (this->locked)
+		if (this->locked.load(std::memory_order_relaxed))
 		{
 #ifdef _UWP
 			String address = hsprintf("<0x%p>", this); // only basic Win32 doesn't add 0x to %p
@@ -98,7 +98,7 @@ namespace hltypes
 				Thread::sleep(1.0f);
 			}
 		}
-		this->locked = true;
+		this->locked.store(true, std::memory_order_relaxed);
 #else
 		pthread_mutex_lock((pthread_mutex_t*)this->handle);
 #endif
@@ -107,7 +107,7 @@ namespace hltypes
 	void Mutex::unlock()
 	{
 #ifdef _WIN32
-		this->locked = false;
+		this->locked.store(false, std::memory_order_relaxed);
 		LeaveCriticalSection((CRITICAL_SECTION*)this->handle);
 #else
 		pthread_mutex_unlock((pthread_mutex_t*)this->handle);
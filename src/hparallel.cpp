@@ -0,0 +1,102 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include <exception>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#define __HL_INCLUDE_PLATFORM_HEADERS
+#include "harray.h"
+#include "hltypesUtil.h"
+#include "hparallel.h"
+#include "hplatform.h"
+#include "hthreadpool.h"
+
+namespace hltypes
+{
+	static int _getHardwareConcurrency()
+	{
+		int result = 1;
+#ifdef _WIN32
+		SYSTEM_INFO info;
+		GetNativeSystemInfo(&info);
+		result = (int)info.dwNumberOfProcessors;
+#else
+		result = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+		return hmax(result, 1);
+	}
+
+	int Parallel::getConcurrency()
+	{
+		// function-local statics are initialized only once, even if multiple threads get here at the same time
+		static int concurrency = _getHardwareConcurrency();
+		return concurrency;
+	}
+
+	int Parallel::getChunkCount(int size)
+	{
+		if (size < PARALLEL_MIN_SIZE)
+		{
+			return 1;
+		}
+		return hclamp(size / PARALLEL_MIN_CHUNK_SIZE, 1, Parallel::getConcurrency());
+	}
+
+	void Parallel::run(void (*function)(int, void*), void* data, int count)
+	{
+		if (count <= 1)
+		{
+			if (count == 1)
+			{
+				(*function)(0, data);
+			}
+			return;
+		}
+		ThreadPool* pool = Parallel::_getPool();
+		Array<ThreadPool::Future<void> > futures;
+		for_iter (i, 1, count)
+		{
+			futures += pool->submit([function, data, i]()
+			{
+				(*function)(i, data);
+			});
+		}
+		std::exception_ptr exception;
+		try
+		{
+			(*function)(0, data);
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+		}
+		// all calls have to be finished before anything is rethrown since they all use data
+		foreach (ThreadPool::Future<void>, it, futures)
+		{
+			(*it).wait();
+		}
+		if (exception)
+		{
+			std::rethrow_exception(exception);
+		}
+		foreach (ThreadPool::Future<void>, it, futures)
+		{
+			(*it).get();
+		}
+	}
+
+	ThreadPool* Parallel::_getPool()
+	{
+		// never destroyed so calls can't outlive their pool, the calling thread does work as well so one worker fewer is needed
+		static ThreadPool* pool = new ThreadPool(hmax(Parallel::getConcurrency() - 1, 1), "hltypes parallel");
+		return pool;
+	}
+
+}
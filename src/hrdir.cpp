@@ -7,6 +7,7 @@
 /// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
 
 #include "harray.h"
+#include "hhashmap.h"
 #include "hdir.h"
 #include "hmap.h"
 #include "hrdir.h"
@@ -18,8 +19,8 @@
 
 namespace hltypes
 {
-	Map<String, Array<String> > ResourceDir::cacheDirectories;
-	Map<String, Array<String> > ResourceDir::cacheFiles;
+	HashMap<String, Array<String> > ResourceDir::cacheDirectories;
+	HashMap<String, Array<String> > ResourceDir::cacheFiles;
 
 	bool ResourceDir::exists(const String& dirName, bool caseSensitive)
 	{
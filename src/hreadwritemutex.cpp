@@ -0,0 +1,114 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#define __HL_INCLUDE_PLATFORM_HEADERS
+#include "hexception.h"
+#include "hplatform.h"
+#include "hreadwritemutex.h"
+
+#ifdef _WIN32
+#define RW_HANDLE ((SRWLOCK*)this->handle.data)
+#else
+#define RW_HANDLE ((pthread_rwlock_t*)this->handle.data)
+#endif
+
+namespace hltypes
+{
+#ifdef _WIN32
+	static_assert(sizeof(SRWLOCK) <= HL_READ_WRITE_MUTEX_HANDLE_SIZE, "HL_READ_WRITE_MUTEX_HANDLE_SIZE is too small for SRWLOCK!");
+#else
+	static_assert(sizeof(pthread_rwlock_t) <= HL_READ_WRITE_MUTEX_HANDLE_SIZE, "HL_READ_WRITE_MUTEX_HANDLE_SIZE is too small for pthread_rwlock_t!");
+#endif
+
+	ReadWriteMutex::ReadWriteMutex(const String& name) :
+		name(name)
+	{
+#ifdef _WIN32
+		InitializeSRWLock(RW_HANDLE);
+#else
+		pthread_rwlock_init(RW_HANDLE, 0);
+#endif
+	}
+
+	ReadWriteMutex::~ReadWriteMutex()
+	{
+#ifndef _WIN32 // SRW locks don't need to be destroyed
+		pthread_rwlock_destroy(RW_HANDLE);
+#endif
+	}
+
+	void ReadWriteMutex::lockRead()
+	{
+#ifdef _WIN32
+		AcquireSRWLockShared(RW_HANDLE);
+#else
+		pthread_rwlock_rdlock(RW_HANDLE);
+#endif
+	}
+
+	bool ReadWriteMutex::tryLockRead()
+	{
+#ifdef _WIN32
+		return (TryAcquireSRWLockShared(RW_HANDLE) != 0);
+#else
+		return (pthread_rwlock_tryrdlock(RW_HANDLE) == 0);
+#endif
+	}
+
+	void ReadWriteMutex::unlockRead()
+	{
+#ifdef _WIN32
+		ReleaseSRWLockShared(RW_HANDLE);
+#else
+		pthread_rwlock_unlock(RW_HANDLE);
+#endif
+	}
+
+	void ReadWriteMutex::lockWrite()
+	{
+#ifdef _WIN32
+		AcquireSRWLockExclusive(RW_HANDLE);
+#else
+		pthread_rwlock_wrlock(RW_HANDLE);
+#endif
+	}
+
+	bool ReadWriteMutex::tryLockWrite()
+	{
+#ifdef _WIN32
+		return (TryAcquireSRWLockExclusive(RW_HANDLE) != 0);
+#else
+		return (pthread_rwlock_trywrlock(RW_HANDLE) == 0);
+#endif
+	}
+
+	void ReadWriteMutex::unlockWrite()
+	{
+#ifdef _WIN32
+		ReleaseSRWLockExclusive(RW_HANDLE);
+#else
+		pthread_rwlock_unlock(RW_HANDLE);
+#endif
+	}
+
+	ReadWriteMutex::ReadWriteMutex(const ReadWriteMutex& other)
+	{
+		throw ObjectCannotCopyException("hltypes::ReadWriteMutex");
+	}
+
+	ReadWriteMutex& ReadWriteMutex::operator=(ReadWriteMutex& other)
+	{
+		throw ObjectCannotAssignException("hltypes::ReadWriteMutex");
+		return (*this);
+	}
+
+}
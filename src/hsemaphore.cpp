@@ -6,10 +6,13 @@
 /// This program is free software; you can redistribute it and/or modify it under
 /// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
 
-#ifndef _WIN32
+#ifdef __APPLE__ // Apple doesn't support unnamed POSIX semaphores
+#include <dispatch/dispatch.h>
+#elif !defined(_WIN32)
 #include <semaphore.h>
-#include <fcntl.h>
 #include <errno.h>
+#include <string.h>
+#include <time.h>
 #endif
 #include <stdio.h>
 #include <stdlib.h>
@@ -33,9 +36,16 @@ namespace hltypes
 #else
 		this->handle = CreateSemaphoreExW(NULL, this->maxCount, this->maxCount, L"", 0, 0); // this->name is NOT a system name!
 #endif
+#elif defined(__APPLE__)
+		// libdispatch crashes when a semaphore is released with a lower value than it was created with so it starts at 0
+		this->handle = dispatch_semaphore_create(0);
+		for_iter (i, 0, this->maxCount)
+		{
+			dispatch_semaphore_signal((dispatch_semaphore_t)this->handle);
+		}
 #else
-		this->handle = sem_open(this->name.cStr(), O_CREAT|O_EXCL, this->maxCount);
-		if (this->handle == SEM_FAILED)
+		this->handle = (sem_t*)malloc(sizeof(sem_t));
+		if (sem_init((sem_t*)this->handle, 0, this->maxCount) != 0)
 		{
 			Log::writef("semaphore", "Error creating POSIX semaphore '%s'! errno = %s", this->name.cStr(), String(strerror(errno)).cStr());
 		}
@@ -46,8 +56,11 @@ namespace hltypes
 	{
 #ifdef _WIN32
 		CloseHandle(this->handle);
+#elif defined(__APPLE__)
+		dispatch_release((dispatch_semaphore_t)this->handle);
 #else
-		sem_close((sem_t*)this->handle);
+		sem_destroy((sem_t*)this->handle);
+		free((sem_t*)this->handle);
 #endif
 	}
 
@@ -55,8 +68,49 @@ namespace hltypes
 	{
 #ifdef _WIN32
 		WaitForSingleObjectEx(this->handle, INFINITE, FALSE);
+#elif defined(__APPLE__)
+		dispatch_semaphore_wait((dispatch_semaphore_t)this->handle, DISPATCH_TIME_FOREVER);
+#else
+		while (sem_wait((sem_t*)this->handle) != 0 && errno == EINTR)
+		{
+		}
+#endif
+	}
+
+	bool Semaphore::tryLock()
+	{
+#ifdef _WIN32
+		return (WaitForSingleObjectEx(this->handle, 0, FALSE) == WAIT_OBJECT_0);
+#elif defined(__APPLE__)
+		return (dispatch_semaphore_wait((dispatch_semaphore_t)this->handle, DISPATCH_TIME_NOW) == 0);
 #else
-		sem_wait((sem_t*)this->handle);
+		int result = 0;
+		while ((result = sem_trywait((sem_t*)this->handle)) != 0 && errno == EINTR)
+		{
+		}
+		return (result == 0);
+#endif
+	}
+
+	bool Semaphore::lock(float timeout)
+	{
+		timeout = hmax(timeout, 0.0f);
+#ifdef _WIN32
+		return (WaitForSingleObjectEx(this->handle, (DWORD)timeout, FALSE) == WAIT_OBJECT_0);
+#elif defined(__APPLE__)
+		return (dispatch_semaphore_wait((dispatch_semaphore_t)this->handle, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(timeout * 1000000.0f))) == 0);
+#else
+		// sem_timedwait() only supports an absolute timeout of the system clock
+		struct timespec time;
+		clock_gettime(CLOCK_REALTIME, &time);
+		int64_t nanoseconds = (int64_t)(timeout * 1000000.0f) + time.tv_nsec;
+		time.tv_sec += (time_t)(nanoseconds / 1000000000LL);
+		time.tv_nsec = (long)(nanoseconds % 1000000000LL);
+		int result = 0;
+		while ((result = sem_timedwait((sem_t*)this->handle, &time)) != 0 && errno == EINTR)
+		{
+		}
+		return (result == 0);
 #endif
 	}
 
@@ -64,6 +118,8 @@ namespace hltypes
 	{
 #ifdef _WIN32
 		ReleaseSemaphore(this->handle, 1, NULL);
+#elif defined(__APPLE__)
+		dispatch_semaphore_signal((dispatch_semaphore_t)this->handle);
 #else
 		sem_post((sem_t*)this->handle);
 #endif
@@ -0,0 +1,73 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include <thread>
+
+#define __HL_INCLUDE_PLATFORM_HEADERS
+#include "hexception.h"
+#include "hplatform.h"
+#include "hspinmutex.h"
+
+// how often the lock is checked with a CPU pause in between before the thread starts yielding
+#define SPIN_COUNT 1000
+
+#if defined(_MSC_VER)
+#define CPU_PAUSE() YieldProcessor()
+#elif defined(__i386__) || defined(__x86_64__)
+#define CPU_PAUSE() __builtin_ia32_pause()
+#elif defined(__aarch64__) || (defined(__arm__) && __ARM_ARCH >= 7)
+#define CPU_PAUSE() __asm__ __volatile__("yield")
+#else
+#define CPU_PAUSE()
+#endif
+
+namespace hltypes
+{
+	SpinMutex::SpinMutex(const String& name) :
+		locked(false),
+		name(name)
+	{
+	}
+
+	SpinMutex::~SpinMutex()
+	{
+	}
+
+	void SpinMutex::_lockContended()
+	{
+		int spinCount = 0;
+		do
+		{
+			// only reading while waiting keeps the cache line shared between cores until the owner releases it
+			while (this->locked.load(std::memory_order_relaxed))
+			{
+				if (spinCount < SPIN_COUNT)
+				{
+					CPU_PAUSE();
+					++spinCount;
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		} while (this->locked.exchange(true, std::memory_order_acquire));
+	}
+
+	SpinMutex::SpinMutex(const SpinMutex& other)
+	{
+		throw ObjectCannotCopyException("hltypes::SpinMutex");
+	}
+
+	SpinMutex& SpinMutex::operator=(SpinMutex& other)
+	{
+		throw ObjectCannotAssignException("hltypes::SpinMutex");
+		return (*this);
+	}
+
+}
@@ -17,12 +17,14 @@
 #include "hexception.h"
 #include "hlog.h"
 #include "hltypesUtil.h"
+#include "hmap.h"
 #include "hplatform.h"
 #include "hstring.h"
 #include "platform_internal.h"
 
 #define FORMAT_BUFFER_SIZE 16
 #define FORMATTING_STRING_BUFFER_SIZE 64
+#define VSPRINTF_BUFFER_SIZE 256
 
 #define BOOL_TO_STRING(b) ((b) ? "true" : "false")
 
@@ -275,6 +277,160 @@ namespace hltypes
 	};
 #endif
 
+	/// @brief Node of the Aho-Corasick automaton used by String::replace() with multiple substrings.
+	struct _ReplaceNode
+	{
+		/// @brief Transitions to child nodes.
+		std::vector<std::pair<unsigned char, int> > children;
+		/// @brief Node of the longest proper suffix that is also a prefix of a substring.
+		int failure;
+		/// @brief Nearest node on the failure chain that completes a substring.
+		int dictionary;
+		/// @brief Index of the substring completed by this node, -1 if none.
+		int index;
+
+		_ReplaceNode() : failure(0), dictionary(-1), index(-1)
+		{
+		}
+
+	};
+
+	static inline int _replaceNodeChild(const std::vector<_ReplaceNode>& nodes, int node, unsigned char c)
+	{
+		const std::vector<std::pair<unsigned char, int> >& children = nodes[node].children;
+		for_itert (size_t, i, 0, children.size())
+		{
+			if (children[i].first == c)
+			{
+				return children[i].second;
+			}
+		}
+		return -1;
+	}
+
+	static inline int _replaceNodeNext(const std::vector<_ReplaceNode>& nodes, int node, unsigned char c)
+	{
+		int child = _replaceNodeChild(nodes, node, c);
+		while (child < 0 && node != 0)
+		{
+			node = nodes[node].failure;
+			child = _replaceNodeChild(nodes, node, c);
+		}
+		return (child >= 0 ? child : 0);
+	}
+
+	// search kernels, memchr() is used to skip ahead since it's vectorized on all supported platforms
+
+	static inline int _findChar(const char* data, int size, char c, int start)
+	{
+		if (start < 0 || start >= size)
+		{
+			return -1;
+		}
+		const char* found = (const char*)memchr(data + start, c, size - start);
+		return (found != NULL ? (int)(found - data) : -1);
+	}
+
+	static inline int _findString(const char* data, int size, const char* string, int length, int start)
+	{
+		if (start < 0 || start > size - length)
+		{
+			return -1;
+		}
+		if (length <= 1)
+		{
+			return (length == 1 ? _findChar(data, size, string[0], start) : start);
+		}
+		// candidates are found through the first character and then filtered through the last character before comparing the rest
+		const char first = string[0];
+		const char last = string[length - 1];
+		const char* current = data + start;
+		const char* end = data + size - length + 1;
+		while (current < end)
+		{
+			current = (const char*)memchr(current, first, end - current);
+			if (current == NULL)
+			{
+				break;
+			}
+			if (current[length - 1] == last && memcmp(current + 1, string + 1, length - 2) == 0)
+			{
+				return (int)(current - data);
+			}
+			++current;
+		}
+		return -1;
+	}
+
+	static inline void _makeCharacterSet(const char* string, int length, bool characters[256])
+	{
+		memset(characters, 0, 256 * sizeof(bool));
+		for_iter (i, 0, length)
+		{
+			characters[(unsigned char)string[i]] = true;
+		}
+	}
+
+	static inline int _findAny(const char* data, int size, const char* string, int length, int start)
+	{
+		if (start < 0 || start >= size || length == 0)
+		{
+			return -1;
+		}
+		if (length == 1)
+		{
+			return _findChar(data, size, string[0], start);
+		}
+		bool characters[256];
+		_makeCharacterSet(string, length, characters);
+		for_iter (i, start, size)
+		{
+			if (characters[(unsigned char)data[i]])
+			{
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	static inline int _count(const char* data, int size, const char* string, int length)
+	{
+		if (length == 0)
+		{
+			return 0;
+		}
+		int result = 0;
+		int position = _findString(data, size, string, length, 0);
+		while (position >= 0)
+		{
+			++result;
+			position = _findString(data, size, string, length, position + length);
+		}
+		return result;
+	}
+
+	static inline bool _containsAll(const char* data, int size, const char* string, int length)
+	{
+		if (length == 0)
+		{
+			return true;
+		}
+		if (length == 1)
+		{
+			return (_findChar(data, size, string[0], 0) >= 0);
+		}
+		bool characters[256];
+		_makeCharacterSet(data, size, characters);
+		for_iter (i, 0, length)
+		{
+			if (!characters[(unsigned char)string[i]])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
 	String::String() :
 		stdstr()
 	{
@@ -296,7 +452,12 @@ namespace hltypes
 	}
 
 	String::String(const String& string) :
-		stdstr(string.c_str())
+		stdstr(string)
+	{
+	}
+
+	String::String(String&& string) noexcept :
+		stdstr(std::move(string))
 	{
 	}
 
@@ -413,7 +574,7 @@ namespace hltypes
 
 	void String::set(const String& string)
 	{
-		stdstr::assign(string.c_str());
+		stdstr::assign(string);
 	}
 
 	void String::set(const String& string, const int length)
@@ -532,7 +693,7 @@ namespace hltypes
 
 	void String::add(const String& string)
 	{
-		stdstr::append(string.c_str());
+		stdstr::append(string);
 	}
 
 	void String::add(const String& string, const int length)
@@ -728,121 +889,78 @@ namespace hltypes
 
 	void String::replace(const String& what, const String& withWhat)
 	{
-		this->replace(what.c_str(), withWhat.c_str());
+		this->_replace(what.c_str(), (int)what.size(), withWhat.c_str(), (int)withWhat.size(), -1);
 	}
 
 	void String::replace(const String& what, const String& withWhat, int times)
 	{
-		this->replace(what.c_str(), withWhat.c_str(), times);
+		this->_replace(what.c_str(), (int)what.size(), withWhat.c_str(), (int)withWhat.size(), hmax(times, 0));
 	}
 
 	void String::replace(const String& what, const char* withWhat)
 	{
-		this->replace(what.c_str(), withWhat);
+		this->_replace(what.c_str(), (int)what.size(), withWhat, (int)strlen(withWhat), -1);
 	}
 
 	void String::replace(const String& what, const char* withWhat, int times)
 	{
-		this->replace(what.c_str(), withWhat, times);
+		this->_replace(what.c_str(), (int)what.size(), withWhat, (int)strlen(withWhat), hmax(times, 0));
 	}
 
 	void String::replace(const String& what, const char withWhat, int times)
 	{
-		this->replace(what.c_str(), withWhat, times);
+		times = hmax(times, 0);
+		String replacement(withWhat, times);
+		this->_replace(what.c_str(), (int)what.size(), replacement.c_str(), times, -1);
 	}
 
 	void String::replace(const char* what, const String& withWhat)
 	{
-		this->replace(what, withWhat.c_str());
+		this->_replace(what, (int)strlen(what), withWhat.c_str(), (int)withWhat.size(), -1);
 	}
 
 	void String::replace(const char* what, const String& withWhat, int times)
 	{
-		this->replace(what, withWhat.c_str(), times);
+		this->_replace(what, (int)strlen(what), withWhat.c_str(), (int)withWhat.size(), hmax(times, 0));
 	}
 
 	void String::replace(const char* what, const char* withWhat)
 	{
-		int whatLength = (int)strlen(what);
-		if (whatLength == 0)
-		{
-			Log::warn(logTag, "Cannot replace empty string in string: " + *this);
-			return;
-		}
-		int withWhatLength = (int)strlen(withWhat);
-		size_t position = 0;
-		while (true)
-		{
-			position = stdstr::find(what, position);
-			if (position == std::string::npos)
-			{
-				break;
-			}
-			stdstr::replace(position, whatLength, withWhat);
-			position += withWhatLength;
-		}
+		this->_replace(what, (int)strlen(what), withWhat, (int)strlen(withWhat), -1);
 	}
 
 	void String::replace(const char* what, const char* withWhat, int times)
 	{
-		int whatLength = (int)strlen(what);
-		if (whatLength == 0)
-		{
-			Log::warn(logTag, "Cannot replace empty string in string: " + *this);
-			return;
-		}
-		int withWhatLength = (int)strlen(withWhat);
-		size_t position = 0;
-		while (times > 0)
-		{
-			position = stdstr::find(what, position);
-			if (position == std::string::npos)
-			{
-				break;
-			}
-			stdstr::replace(position, whatLength, withWhat);
-			position += withWhatLength;
-			--times;
-		}
+		this->_replace(what, (int)strlen(what), withWhat, (int)strlen(withWhat), hmax(times, 0));
 	}
 
 	void String::replace(const char* what, const char withWhat, int times)
 	{
-		int whatLength = (int)strlen(what);
-		if (whatLength == 0)
-		{
-			Log::warn(logTag, "Cannot replace empty string in string: " + *this);
-			return;
-		}
-		size_t position = 0;
-		while (true)
-		{
-			position = stdstr::find(what, position);
-			if (position == std::string::npos)
-			{
-				break;
-			}
-			stdstr::replace(position, whatLength, times, withWhat);
-			position += times;
-		}
+		times = hmax(times, 0);
+		String replacement(withWhat, times);
+		this->_replace(what, (int)strlen(what), replacement.c_str(), times, -1);
 	}
 
 	void String::replace(const char what, const String& withWhat)
 	{
-		const char string[2] = { what, '\0' };
-		return this->replace(string, withWhat.c_str());
+		this->_replace(&what, 1, withWhat.c_str(), (int)withWhat.size(), -1);
 	}
 
 	void String::replace(const char what, const char* withWhat)
 	{
-		const char string[2] = { what, '\0' };
-		return this->replace(string, withWhat);
+		this->_replace(&what, 1, withWhat, (int)strlen(withWhat), -1);
 	}
 
 	void String::replace(const char what, const char withWhat, int times)
 	{
-		const char string[2] = { what, '\0' };
-		return this->replace(string, withWhat, times);
+		if (times == 1) // most common case, characters can be swapped in place
+		{
+			std::replace(stdstr::begin(), stdstr::end(), what, withWhat);
+			return;
+		}
+		times = hmax(times, 0);
+		String replacement(withWhat, times);
+		this->_replace(&what, 1, replacement.c_str(), times, -1);
 	}
 
 	void String::replace(int position, int count, const String& string)
@@ -860,6 +978,106 @@ namespace hltypes
 		stdstr::replace(position, count, times, character);
 	}
 
+	void String::replace(const Map<String, String>& replacements)
+	{
+		// building an Aho-Corasick automaton of the reversed substrings so all substrings can be found in one backward pass
+		std::vector<_ReplaceNode> nodes(1);
+		std::vector<const String*> whats;
+		std::vector<const String*> withWhats;
+		for (Map<String, String>::const_iterator_t it = replacements.begin(); it != replacements.end(); ++it)
+		{
+			if (it->first.size() == 0)
+			{
+				Log::warn(logTag, "Cannot replace empty string in string: " + *this);
+				continue;
+			}
+			int node = 0;
+			const unsigned char* what = (const unsigned char*)it->first.c_str();
+			for (int i = it->first.size() - 1; i >= 0; --i)
+			{
+				int child = _replaceNodeChild(nodes, node, what[i]);
+				if (child < 0)
+				{
+					child = (int)nodes.size();
+					nodes.push_back(_ReplaceNode());
+					nodes[node].children.push_back(std::pair<unsigned char, int>(what[i], child));
+				}
+				node = child;
+			}
+			nodes[node].index = (int)whats.size();
+			whats.push_back(&it->first);
+			withWhats.push_back(&it->second);
+		}
+		if (whats.size() == 0)
+		{
+			return;
+		}
+		// breadth-first traversal so failure links always point to already processed nodes
+		std::vector<int> queue;
+		queue.reserve(nodes.size());
+		queue.push_back(0);
+		for_itert (size_t, q, 0, queue.size())
+		{
+			int node = queue[q];
+			for_itert (size_t, j, 0, nodes[node].children.size())
+			{
+				unsigned char c = nodes[node].children[j].first;
+				int child = nodes[node].children[j].second;
+				if (node != 0)
+				{
+					nodes[child].failure = _replaceNodeNext(nodes, nodes[node].failure, c);
+				}
+				int failure = nodes[child].failure;
+				nodes[child].dictionary = (nodes[failure].index >= 0 ? failure : nodes[failure].dictionary);
+				queue.push_back(child);
+			}
+		}
+		// scanning backwards, the longest reversed substring ending at a position is the longest substring starting there
+		const unsigned char* data = (const unsigned char*)stdstr::data();
+		int size = (int)stdstr::size();
+		std::vector<int> longest(size);
+		int node = 0;
+		int found = 0;
+		for (int i = size - 1; i >= 0; --i)
+		{
+			node = _replaceNodeNext(nodes, node, data[i]);
+			found = (nodes[node].index >= 0 ? node : nodes[node].dictionary);
+			longest[i] = (found >= 0 ? nodes[found].index : -1);
+		}
+		// taking leftmost-longest non-overlapping matches
+		std::vector<std::pair<int, int> > matches; // start position and substring index
+		int newSize = size;
+		int i = 0;
+		while (i < size)
+		{
+			if (longest[i] >= 0)
+			{
+				matches.push_back(std::pair<int, int>(i, longest[i]));
+				newSize += withWhats[longest[i]]->size() - whats[longest[i]]->size();
+				i += whats[longest[i]]->size();
+			}
+			else
+			{
+				++i;
+			}
+		}
+		if (matches.size() == 0)
+		{
+			return;
+		}
+		stdstr result;
+		result.reserve(newSize);
+		int current = 0;
+		for_itert (size_t, j, 0, matches.size())
+		{
+			result.append((const char*)data + current, matches[j].first - current);
+			result.append(withWhats[matches[j].second]->c_str(), withWhats[matches[j].second]->size());
+			current = matches[j].first + whats[matches[j].second]->size();
+		}
+		result.append((const char*)data + current, size - current);
+		stdstr::swap(result);
+	}
+
 	String String::replaced(const String& what, const String& withWhat) const
 	{
 		String result(*this);
@@ -942,6 +1160,59 @@ namespace hltypes
 		return result;
 	}
 
+	String String::replaced(const Map<String, String>& replacements) const
+	{
+		String result(*this);
+		result.replace(replacements);
+		return result;
+	}
+
+	void String::_replace(const char* what, int whatLength, const char* withWhat, int withWhatLength, int times)
+	{
+		if (whatLength == 0)
+		{
+			Log::warn(logTag, "Cannot replace empty string in string: " + *this);
+			return;
+		}
+		if (times == 0)
+		{
+			return;
+		}
+		// finding all occurrences first so the result can be allocated with its final size
+		Array<int> positions;
+		const char* data = stdstr::data();
+		int size = (int)stdstr::size();
+		int position = _findString(data, size, what, whatLength, 0);
+		while (position >= 0 && (times < 0 || positions.size() < times))
+		{
+			positions.add(position);
+			position = _findString(data, size, what, whatLength, position + whatLength);
+		}
+		if (positions.size() == 0)
+		{
+			return;
+		}
+		if (whatLength == withWhatLength) // same length, can be overwritten in place
+		{
+			foreachc (int, it, positions)
+			{
+				stdstr::replace((*it), whatLength, withWhat, withWhatLength);
+			}
+			return;
+		}
+		stdstr result;
+		result.reserve(size + positions.size() * (withWhatLength - whatLength));
+		int current = 0;
+		foreachc (int, it, positions)
+		{
+			result.append(data + current, (*it) - current);
+			result.append(withWhat, withWhatLength);
+			current = (*it) + whatLength;
+		}
+		result.append(data + current, size - current);
+		stdstr::swap(result);
+	}
+
 	void String::insertAt(int position, const String& string)
 	{
 		if (position >= 0 && position <= (int)stdstr::size())
@@ -1222,17 +1493,17 @@ namespace hltypes
 
 	int String::indexOf(const char c, int start) const
 	{
-		return (int)stdstr::find(c, start);
+		return _findChar(stdstr::data(), (int)stdstr::size(), c, start);
 	}
 
 	int String::indexOf(const char* string, int start) const
 	{
-		return (int)stdstr::find(string, start);
+		return _findString(stdstr::data(), (int)stdstr::size(), string, (int)strlen(string), start);
 	}
 
 	int String::indexOf(const String& string, int start) const
 	{
-		return (int)stdstr::find(string, start);
+		return _findString(stdstr::data(), (int)stdstr::size(), string.c_str(), string.size(), start);
 	}
 
 	int String::utf8IndexOf(const char c, int start) const
@@ -1282,12 +1553,12 @@ namespace hltypes
 
 	int String::indexOfAny(const char* string, int start) const
 	{
-		return (int)stdstr::find_first_of(string, start);
+		return _findAny(stdstr::data(), (int)stdstr::size(), string, (int)strlen(string), start);
 	}
 
 	int String::indexOfAny(const String& string, int start) const
 	{
-		return (int)stdstr::find_first_of(string.c_str(), start);
+		return _findAny(stdstr::data(), (int)stdstr::size(), string.c_str(), string.size(), start);
 	}
 
 	int String::utf8IndexOfAny(const char* string, int start) const
@@ -1322,28 +1593,17 @@ namespace hltypes
 
 	int String::count(const char c) const
 	{
-		const char string[2] = { c, '\0' };
-		return this->count(string);
+		return (int)std::count(stdstr::begin(), stdstr::end(), c);
 	}
 
 	int String::count(const char* string) const
 	{
-		int result = 0;
-		String thisString = stdstr::c_str();
-		for_iter (i, 0, this->size())
-		{
-			if (thisString(i, -1).startsWith(string))
-			{
-				++result;
-				i += strlen(string) - 1;
-			}
-		}
-		return result;
+		return _count(stdstr::data(), (int)stdstr::size(), string, (int)strlen(string));
 	}
 
 	int String::count(const String& string) const
 	{
-		return this->count(string.c_str());
+		return _count(stdstr::data(), (int)stdstr::size(), string.c_str(), string.size());
 	}
 
 	bool String::startsWith(const char* string) const
@@ -1375,53 +1635,37 @@ namespace hltypes
 
 	bool String::contains(const char c) const
 	{
-		return (stdstr::find(c) != stdstr::npos);
+		return (_findChar(stdstr::data(), (int)stdstr::size(), c, 0) >= 0);
 	}
 
 	bool String::contains(const char* string) const
 	{
-		return (stdstr::find(string) != stdstr::npos);
+		return (_findString(stdstr::data(), (int)stdstr::size(), string, (int)strlen(string), 0) >= 0);
 	}
 
 	bool String::contains(const String& string) const
 	{
-		return (stdstr::find(string.c_str()) != stdstr::npos);
+		return (_findString(stdstr::data(), (int)stdstr::size(), string.c_str(), string.size(), 0) >= 0);
 	}
 
 	bool String::containsAny(const char* string) const
 	{
-		int size = (int)strlen(string);
-		for_iter (i, 0, size)
-		{
-			if (stdstr::find(string[i]) != stdstr::npos)
-			{
-				return true;
-			}
-		}
-		return false;
+		return (_findAny(stdstr::data(), (int)stdstr::size(), string, (int)strlen(string), 0) >= 0);
 	}
 
 	bool String::containsAny(const String& string) const
 	{
-		return this->containsAny(string.c_str());
+		return (_findAny(stdstr::data(), (int)stdstr::size(), string.c_str(), string.size(), 0) >= 0);
 	}
 
 	bool String::containsAll(const char* string) const
 	{
-		int size = (int)strlen(string);
-		for_iter (i, 0, size)
-		{
-			if (stdstr::find(string[i]) == stdstr::npos)
-			{
-				return false;
-			}
-		}
-		return true;
+		return _containsAll(stdstr::data(), (int)stdstr::size(), string, (int)strlen(string));
 	}
 
 	bool String::containsAll(const String& string) const
 	{
-		return this->containsAll(string.c_str());
+		return _containsAll(stdstr::data(), (int)stdstr::size(), string.c_str(), string.size());
 	}
 
 	bool String::isDigit() const
@@ -1755,73 +1999,79 @@ namespace hltypes
 		return d;
 	}
 
-	String String::operator=(char* string)
+	String& String::operator=(char* string)
 	{
 		stdstr::assign(string);
 		return *this;
 	}
 
-	String String::operator=(const char* string)
+	String& String::operator=(const char* string)
 	{
 		stdstr::assign(string);
 		return *this;
 	}
 
-	String String::operator=(const String& string)
+	String& String::operator=(const String& string)
 	{
-		stdstr::assign(string.c_str());
+		stdstr::assign(string);
+		return *this;
+	}
+
+	String& String::operator=(String&& string) noexcept
+	{
+		stdstr::assign(std::move(string));
 		return *this;
 	}
 
-	String String::operator=(const bool b)
+	String& String::operator=(const bool b)
 	{
 		stdstr::assign(BOOL_TO_STRING(b));
 		return *this;
 	}
 
-	String String::operator=(const short s)
+	String& String::operator=(const short s)
 	{
 		this->set(s);
 		return *this;
 	}
 
-	String String::operator=(const unsigned short s)
+	String& String::operator=(const unsigned short s)
 	{
 		this->set(s);
 		return *this;
 	}
 
-	String String::operator=(const int i)
+	String& String::operator=(const int i)
 	{
 		this->set(i);
 		return *this;
 	}
 
-	String String::operator=(const unsigned int i)
+	String& String::operator=(const unsigned int i)
 	{
 		this->set(i);
 		return *this;
 	}
 
-	String String::operator=(const int64_t i)
+	String& String::operator=(const int64_t i)
 	{
 		this->set(i);
 		return *this;
 	}
 
-	String String::operator=(const uint64_t i)
+	String& String::operator=(const uint64_t i)
 	{
 		this->set(i);
 		return *this;
 	}
 
-	String String::operator=(const float f)
+	String& String::operator=(const float f)
 	{
 		this->set(f);
 		return *this;
 	}
 	
-	String String::operator=(const double d)
+	String& String::operator=(const double d)
 	{
 		this->set(d);
 		return *this;
@@ -1894,34 +2144,58 @@ namespace hltypes
 		this->add(d);
 	}
 
-	String String::operator+(const char c) const
+	String String::operator+(const char c) const&
 	{
 		String result(*this);
 		result.append(1, c);
 		return result;
 	}
 
-	String String::operator+(char* string) const
+	String String::operator+(const char c) &&
+	{
+		stdstr::append(1, c);
+		return std::move(*this);
+	}
+
+	String String::operator+(char* string) const&
 	{
 		String result(*this);
 		result.append(string);
 		return result;
 	}
 
-	String String::operator+(const char* string) const
+	String String::operator+(char* string) &&
+	{
+		stdstr::append(string);
+		return std::move(*this);
+	}
+
+	String String::operator+(const char* string) const&
 	{
 		String result(*this);
 		result.append(string);
 		return result;
 	}
 
-	String String::operator+(const String& string) const
+	String String::operator+(const char* string) &&
+	{
+		stdstr::append(string);
+		return std::move(*this);
+	}
+
+	String String::operator+(const String& string) const&
 	{
 		String result(*this);
 		result.append(string);
 		return result;
 	}
 
+	String String::operator+(const String& string) &&
+	{
+		stdstr::append(string);
+		return std::move(*this);
+	}
+
 	bool String::operator==(const char* string) const
 	{
 		return (strcmp(stdstr::c_str(), string) == 0);
@@ -2247,41 +2521,36 @@ namespace hltypes
 
 hltypes::String hvsprintf(const char* format, va_list args)
 {
+	// most strings fit into this buffer so the resulting String is the only heap allocation
+	char buffer[VSPRINTF_BUFFER_SIZE];
 	va_list vaCopy; // need to copy args because vsnprintf delets va_args on some platforms, and if we re-call it with a larger buffer, it will fail
-	int size = 256; // safe assumption that most strings will be under 257 characters
-	// not using a static buffer here to assure thread safety
-	char* c = new char[size + 1];
-	c[0] = '\0';
-	int count = 0;
-	int i;
-	for_iterx (i, 0, 8)
-	{
-		// due to different (and non-standard) behavior in different implementations, there is one safe byte
+	va_copy(vaCopy, args);
+	int count = hltypes::_platformVsnprintf(buffer, VSPRINTF_BUFFER_SIZE, format, vaCopy);
+	va_end(vaCopy);
+	if (count >= 0 && count < VSPRINTF_BUFFER_SIZE)
+	{
+		return hltypes::String(buffer, count);
+	}
+	if (count < 0) // some implementations don't return the required size when the output is truncated
+	{
 		va_copy(vaCopy, args);
-		count = hltypes::_platformVsnprintf(c, size, format, vaCopy);
+		count = hltypes::_platformVsnprintf(NULL, 0, format, vaCopy);
 		va_end(vaCopy);
-		if (count >= 0 && count < size)
+		if (count < 0)
 		{
-			c[count] = '\0'; // terminate string
-			break;
-		}
-		size *= 2; // not enough characters, double current buffer
-		delete[] c;
-		c = new char[size + 1];
-		c[0] = '\0';
-	}
-	if (i >= 8)
-	{
 #ifdef _DEBUG
-		delete[] c;
-		throw Exception("Resulting string for hsprintf is longer than 2^16 (65536) characters! format: " + hstr(format));
+			throw Exception("Could not format string in hsprintf! format: " + hstr(format));
 #else
-		hlog::error(hltypes::logTag, "Resulting string for hsprintf is longer than 2^16 (65536) characters! format: " + hstr(format));
-		c[0] = '\0'; // in case sprintf corrupted c
+			hlog::error(hltypes::logTag, "Could not format string in hsprintf! format: " + hstr(format));
+			return hltypes::String();
 #endif
+		}
 	}
-	hltypes::String result(c);
-	delete[] c;
+	// formatting directly into the resulting String's storage
+	hltypes::String result(' ', count);
+	va_copy(vaCopy, args);
+	hltypes::_platformVsnprintf(&result[0], count + 1, format, vaCopy);
+	va_end(vaCopy);
 	return result;
 }
 
@@ -0,0 +1,257 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "hexception.h"
+#include "hltypesUtil.h"
+#include "hstring.h"
+#include "hstringbuilder.h"
+#include "platform_internal.h"
+
+#define FORMAT_BUFFER_SIZE 16
+#define FORMATTING_STRING_BUFFER_SIZE 64
+
+#define BOOL_TO_STRING(b) ((b) ? "true" : "false")
+
+namespace hltypes
+{
+	// same as String(string).trimmedRight('0').trimmedRight('.'), but without the temporary Strings
+	static int _trimmedFloatLength(const char* string, int length)
+	{
+		while (length > 0 && string[length - 1] == '0')
+		{
+			--length;
+		}
+		while (length > 0 && string[length - 1] == '.')
+		{
+			--length;
+		}
+		return length;
+	}
+
+	StringBuilder::StringBuilder(int initialCapacity) :
+		data(NULL),
+		dataSize(0),
+		capacity(hmax(MIN_HSTRING_BUILDER_CAPACITY, initialCapacity))
+	{
+		// using malloc because realloc is used later
+		this->data = (char*)malloc(this->capacity + 1);
+		this->data[0] = '\0';
+	}
+
+	StringBuilder::~StringBuilder()
+	{
+		if (this->data != NULL)
+		{
+			free(this->data);
+		}
+	}
+
+	StringBuilder::StringBuilder(const StringBuilder& other)
+	{
+		throw ObjectCannotCopyException("hltypes::StringBuilder");
+	}
+
+	StringBuilder& StringBuilder::operator=(StringBuilder& other)
+	{
+		throw ObjectCannotAssignException("hltypes::StringBuilder");
+		return (*this);
+	}
+
+	bool StringBuilder::reserve(int newCapacity)
+	{
+		if (newCapacity <= this->capacity)
+		{
+			return true;
+		}
+		char* newData = (char*)realloc(this->data, newCapacity + 1);
+		if (newData == NULL) // could not reallocate enough memory
+		{
+			return false;
+		}
+		this->data = newData;
+		this->capacity = newCapacity;
+		return true;
+	}
+
+	void StringBuilder::clear()
+	{
+		this->dataSize = 0;
+		this->data[0] = '\0';
+	}
+
+	bool StringBuilder::_tryIncreaseCapacity(int count)
+	{
+		int required = this->dataSize + count;
+		if (required <= this->capacity)
+		{
+			return true;
+		}
+		// growing geometrically so many small appends stay amortized O(1)
+		int newCapacity = this->capacity;
+		while (newCapacity < required)
+		{
+			newCapacity <<= 1;
+		}
+		return this->reserve(newCapacity);
+	}
+
+	void StringBuilder::_append(const char* string, int count)
+	{
+		if (count <= 0)
+		{
+			return;
+		}
+		if (!this->_tryIncreaseCapacity(count))
+		{
+			throw Exception("Could not allocate memory for StringBuilder!");
+		}
+		memcpy(&this->data[this->dataSize], string, count);
+		this->dataSize += count;
+		this->data[this->dataSize] = '\0';
+	}
+
+	StringBuilder& StringBuilder::add(const char c)
+	{
+		this->_append(&c, 1);
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const char c, int times)
+	{
+		if (times > 0)
+		{
+			if (!this->_tryIncreaseCapacity(times))
+			{
+				throw Exception("Could not allocate memory for StringBuilder!");
+			}
+			memset(&this->data[this->dataSize], c, times);
+			this->dataSize += times;
+			this->data[this->dataSize] = '\0';
+		}
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const char* string)
+	{
+		this->_append(string, (int)strlen(string));
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const char* string, int length)
+	{
+		this->_append(string, length);
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const String& string)
+	{
+		this->_append(string.cStr(), string.size());
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const String& string, int length)
+	{
+		this->_append(string.cStr(), hmin(length, string.size()));
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const bool b)
+	{
+		return this->add(BOOL_TO_STRING(b));
+	}
+
+	StringBuilder& StringBuilder::add(const short s)
+	{
+		char string[FORMATTING_STRING_BUFFER_SIZE] = { '\0' };
+		this->_append(string, _platformSprintf(string, "%hd", s));
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const unsigned short s)
+	{
+		char string[FORMATTING_STRING_BUFFER_SIZE] = { '\0' };
+		this->_append(string, _platformSprintf(string, "%hu", s));
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const int i)
+	{
+		char string[FORMATTING_STRING_BUFFER_SIZE] = { '\0' };
+		this->_append(string, _platformSprintf(string, "%d", i));
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const unsigned int i)
+	{
+		char string[FORMATTING_STRING_BUFFER_SIZE] = { '\0' };
+		this->_append(string, _platformSprintf(string, "%u", i));
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const int64_t i)
+	{
+		char string[FORMATTING_STRING_BUFFER_SIZE] = { '\0' };
+		this->_append(string, _platformSprintf(string, "%lld", i));
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const uint64_t i)
+	{
+		char string[FORMATTING_STRING_BUFFER_SIZE] = { '\0' };
+		this->_append(string, _platformSprintf(string, "%llu", i));
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const float f)
+	{
+		char string[FORMATTING_STRING_BUFFER_SIZE] = { '\0' };
+		int length = _platformSprintf(string, "%f", f);
+		this->_append(string, _trimmedFloatLength(string, length));
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const float f, int precision)
+	{
+		char format[FORMAT_BUFFER_SIZE] = { '\0' };
+		char string[FORMATTING_STRING_BUFFER_SIZE] = { '\0' };
+		_platformSprintf(format, "%%.%df", precision);
+		this->_append(string, _platformSprintf(string, format, f));
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const double d)
+	{
+		char string[FORMATTING_STRING_BUFFER_SIZE] = { '\0' };
+		int length = _platformSprintf(string, "%lf", d);
+		this->_append(string, _trimmedFloatLength(string, length));
+		return (*this);
+	}
+
+	StringBuilder& StringBuilder::add(const double d, int precision)
+	{
+		char format[FORMAT_BUFFER_SIZE] = { '\0' };
+		char string[FORMATTING_STRING_BUFFER_SIZE] = { '\0' };
+		_platformSprintf(format, "%%.%dlf", precision);
+		this->_append(string, _platformSprintf(string, format, d));
+		return (*this);
+	}
+
+	String StringBuilder::str() const
+	{
+		return String(this->data, this->dataSize);
+	}
+
+	const char* StringBuilder::cStr() const
+	{
+		return this->data;
+	}
+
+}
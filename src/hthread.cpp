@@ -9,8 +9,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #ifndef _WIN32
-#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
 #include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
 #endif
 
 #define __HL_INCLUDE_PLATFORM_HEADERS
@@ -110,14 +115,18 @@ namespace hltypes
 		this->thread->_execute();
 	}
 
-	Thread::Thread(void (*function)(Thread*), const String& name) :
+	Thread::Thread(void (*function)(Thread*), const String& name, const Attributes& attributes) :
 		executing(false),
+		attributes(attributes),
 		runner(this),
 		id(0),
-		running(false)
+		running(false),
+		cancelRequested(false),
+		finished(false, name)
 	{
 		this->function = function;
 		this->name = name;
+		this->finished.set();
 	}
 
 	Thread::~Thread()
@@ -127,6 +136,11 @@ namespace hltypes
 			Log::warn(logTag, "Thread still executing in destructor! Attempting 'stop', but this may be unsafe. The thread should be joined before deleting it.");
 			this->stop();
 		}
+		else if (this->id != NULL)
+		{
+			// the function has returned, but the thread could still be finishing up so it has to be reaped
+			this->_platformJoin();
+		}
 		this->_clear();
 	}
 
@@ -137,8 +151,15 @@ namespace hltypes
 			Log::errorf(logTag, "Thread '%s' already running, cannot start!", this->name.cStr());
 			return;
 		}
+		if (this->id != NULL)
+		{
+			// the thread has exited on its own, but it still has to be reaped before its data can be cleared
+			this->_platformJoin();
+		}
+		this->_clear();
 		this->running = true;
-		this->_clear(); // if thread exited on its own, but the data is still allocated
+		this->cancelRequested.store(false, std::memory_order_release);
+		this->finished.reset();
 		this->_platformStart();
 	}
 
@@ -151,6 +172,23 @@ namespace hltypes
 		this->executing = false;
 	}
 
+	bool Thread::join(float timeout)
+	{
+		if (!this->finished.wait(timeout))
+		{
+			return false;
+		}
+		this->running = false;
+		this->_platformJoin();
+		this->_clear();
+		return true;
+	}
+
+	void Thread::requestCancel()
+	{
+		this->cancelRequested.store(true, std::memory_order_release);
+	}
+
 	void Thread::resume()
 	{
 		this->_platformResume();
@@ -170,9 +208,15 @@ namespace hltypes
 			this->_clear();
 			// aborted execution can leave this variable in any state, reset it
 			this->executing = false;
+			this->finished.set();
 		}
 		else
 		{
+			if (this->id != NULL)
+			{
+				// the function has already returned so this only reaps the thread
+				this->_platformJoin();
+			}
 			this->_clear();
 		}
 	}
@@ -181,6 +225,7 @@ namespace hltypes
 	{
 		if (this->running && this->function != NULL)
 		{
+			this->_platformApplyAttributes();
 			this->executing = true;
 			try
 			{
@@ -194,6 +239,7 @@ namespace hltypes
 		}
 		this->executing = false;
 		this->running = false;
+		this->finished.set();
 	}
 
 	void Thread::_clear()
@@ -217,8 +263,42 @@ namespace hltypes
 	{
 #ifdef _WIN32
 #ifndef _UWP
-		this->id = CreateThread(0, 0, &_asyncCall, &this->runner, 0, 0);
+		// started suspended so affinity and priority apply before the thread's function runs
+		this->id = CreateThread(0, (SIZE_T)hmax(this->attributes.stackSize, 0), &_asyncCall, &this->runner, CREATE_SUSPENDED, 0);
+		if (this->id != NULL)
+		{
+			if (this->attributes.affinityMask != 0ULL && SetThreadAffinityMask(this->id, (DWORD_PTR)this->attributes.affinityMask) == 0)
+			{
+				Log::warnf(logTag, "Could not set affinity of thread '%s'!", this->name.cStr());
+			}
+			if (this->attributes.priority != 0)
+			{
+				int priority = THREAD_PRIORITY_NORMAL;
+				if (this->attributes.priority <= -15)
+				{
+					priority = THREAD_PRIORITY_HIGHEST;
+				}
+				else if (this->attributes.priority <= -5)
+				{
+					priority = THREAD_PRIORITY_ABOVE_NORMAL;
+				}
+				else if (this->attributes.priority >= 15)
+				{
+					priority = THREAD_PRIORITY_LOWEST;
+				}
+				else if (this->attributes.priority >= 5)
+				{
+					priority = THREAD_PRIORITY_BELOW_NORMAL;
+				}
+				SetThreadPriority(this->id, priority);
+			}
+			ResumeThread(this->id);
+		}
 #else
+		if (this->attributes.stackSize != 0 || this->attributes.affinityMask != 0ULL || this->attributes.priority != 0)
+		{
+			Log::warn(logTag, "Thread attributes are not supported on UWP.");
+		}
 		this->id = new AsyncActionWrapper(ThreadPool::RunAsync(ref new WorkItemHandler([&](IAsyncAction^ workItem)
 		{
 			if (this->name != "")
@@ -231,7 +311,14 @@ namespace hltypes
 #else
 		pthread_t* thread = (pthread_t*)malloc(sizeof(pthread_t));
 		this->id = thread;
-		pthread_create(thread, NULL, &_asyncCall, &this->runner);
+		pthread_attr_t attributes;
+		pthread_attr_init(&attributes);
+		if (this->attributes.stackSize > 0)
+		{
+			pthread_attr_setstacksize(&attributes, (size_t)hmax(this->attributes.stackSize, (int)PTHREAD_STACK_MIN));
+		}
+		pthread_create(thread, &attributes, &_asyncCall, &this->runner);
+		pthread_attr_destroy(&attributes);
 #ifndef __APPLE__
 		if (this->name != "")
 		{
@@ -241,6 +328,52 @@ namespace hltypes
 #endif
 	}
 
+	void Thread::_platformApplyAttributes()
+	{
+#if defined(__linux__) // includes Android
+		if (this->attributes.affinityMask != 0ULL)
+		{
+			cpu_set_t cpus;
+			CPU_ZERO(&cpus);
+			for_iter (i, 0, 64)
+			{
+				if ((this->attributes.affinityMask & (1ULL << i)) != 0ULL)
+				{
+					CPU_SET(i, &cpus);
+				}
+			}
+			// 0 is the calling thread
+			if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0)
+			{
+				Log::warnf(logTag, "Could not set affinity of thread '%s'! errno = %s", this->name.cStr(), String(strerror(errno)).cStr());
+			}
+		}
+		if (this->attributes.priority != 0)
+		{
+			// the nice value is per thread on Linux and 0 is the calling thread
+			if (setpriority(PRIO_PROCESS, 0, hclamp(this->attributes.priority, -20, 19)) != 0)
+			{
+				Log::warnf(logTag, "Could not set priority of thread '%s'! errno = %s", this->name.cStr(), String(strerror(errno)).cStr());
+			}
+		}
+#elif defined(__APPLE__)
+		// Apple has no way to bind threads to cores, only the priority within the normal scheduling policy can be changed
+		if (this->attributes.priority != 0)
+		{
+			int policy = 0;
+			struct sched_param parameters;
+			pthread_getschedparam(pthread_self(), &policy, &parameters);
+			int minimum = sched_get_priority_min(policy);
+			int maximum = sched_get_priority_max(policy);
+			int priority = hclamp(this->attributes.priority, -20, 19);
+			// nice values are inverted, the default of 0 maps to the middle of the range
+			int middle = (minimum + maximum) / 2;
+			parameters.sched_priority = (priority < 0 ? middle + (maximum - middle) * -priority / 20 : middle - (middle - minimum) * priority / 19);
+			pthread_setschedparam(pthread_self(), policy, &parameters);
+		}
+#endif
+	}
+
 	void Thread::_platformJoin()
 	{
 		if (this->id == NULL)
@@ -336,6 +469,17 @@ namespace hltypes
 #endif
 	}
 
+	int Thread::getCurrentCore()
+	{
+#ifdef _WIN32
+		return (int)GetCurrentProcessorNumber();
+#elif defined(__linux__)
+		return sched_getcpu();
+#else
+		return -1;
+#endif
+	}
+
 	Thread::Thread(const Thread& other) :
 		runner(this)
 	{
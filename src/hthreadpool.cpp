@@ -0,0 +1,277 @@
+/// @file
+/// @version 4.0
+/// 
+/// @section LICENSE
+/// 
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include "harray.h"
+#include "hconditionvariable.h"
+#include "hexception.h"
+#include "hltypesUtil.h"
+#include "hmutex.h"
+#include "hparallel.h"
+#include "hspinmutex.h"
+#include "hthread.h"
+#include "hthreadpool.h"
+
+namespace hltypes
+{
+	/// @brief The worker executing on the current thread.
+	static thread_local Thread* _currentWorker = NULL;
+
+	/// @brief Worker thread of a ThreadPool with its own queue of tasks.
+	class ThreadPool::Worker : public Thread
+	{
+	public:
+		/// @brief The pool.
+		ThreadPool* pool;
+		/// @brief Index of the worker in the pool.
+		int index;
+		/// @brief Tasks submitted from this worker. The worker takes tasks from the back, other workers steal from the front.
+		std::deque<_Task*> tasks;
+		/// @brief Mutex for the task queue, it is only held for a push or pop.
+		SpinMutex mutex;
+
+		Worker(ThreadPool* pool, int index, const String& name) : Thread(&Worker::_run, name), pool(pool), index(index), mutex(name)
+		{
+		}
+
+	protected:
+		static void _run(Thread* thread)
+		{
+			Worker* worker = (Worker*)thread;
+			ThreadPool* pool = worker->pool;
+			_currentWorker = worker;
+			Mutex::ScopeLock lock;
+			while (true)
+			{
+				if (pool->_executeNext(worker))
+				{
+					continue;
+				}
+				lock.acquire(&pool->mutex);
+				if (pool->stopping)
+				{
+					break;
+				}
+				if (pool->queued == 0)
+				{
+					pool->condition.wait(&lock);
+				}
+				lock.release();
+			}
+			lock.release();
+			_currentWorker = NULL;
+		}
+
+	};
+
+	ThreadPool::ThreadPool(int workerCount, const String& name) : name(name), pending(0), queued(0), waiting(0), stopping(false), mutex(name), condition(name)
+	{
+		if (workerCount <= 0)
+		{
+			workerCount = Parallel::getConcurrency();
+		}
+		for_iter (i, 0, workerCount)
+		{
+			this->workers += new Worker(this, i, this->name + " " + String(i));
+		}
+		foreach (Worker*, it, this->workers)
+		{
+			(*it)->start();
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		this->waitAll();
+		Mutex::ScopeLock lock(&this->mutex);
+		this->stopping = true;
+		this->condition.broadcast();
+		lock.release();
+		// workers can still try to steal from each other until all have stopped
+		foreach (Worker*, it, this->workers)
+		{
+			(*it)->join();
+		}
+		foreach (Worker*, it, this->workers)
+		{
+			delete (*it);
+		}
+	}
+
+	int ThreadPool::getPendingCount()
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		return this->pending;
+	}
+
+	void ThreadPool::waitAll()
+	{
+		Worker* worker = this->_getCurrentWorker();
+		Mutex::ScopeLock lock(&this->mutex);
+		while (this->pending > 0)
+		{
+			this->_executeOrBlock(worker, &lock);
+		}
+	}
+
+	void ThreadPool::_submit(_Task* task)
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		++this->pending;
+		++this->queued;
+		Worker* worker = this->_getCurrentWorker();
+		if (worker == NULL)
+		{
+			this->tasks.push_back(task);
+			this->condition.signal();
+			return;
+		}
+		lock.release();
+		SpinMutex::ScopeLock queueLock(&worker->mutex);
+		worker->tasks.push_back(task);
+		queueLock.release();
+		// the counter was already increased while the pool mutex was locked so a thread that just checked it is already blocked
+		this->condition.signal();
+	}
+
+	bool ThreadPool::_executeNext(Worker* worker)
+	{
+		_Task* task = this->_take(worker);
+		if (task == NULL)
+		{
+			return false;
+		}
+		this->_execute(task);
+		return true;
+	}
+
+	ThreadPool::_Task* ThreadPool::_take(Worker* worker)
+	{
+		_Task* task = NULL;
+		SpinMutex::ScopeLock queueLock;
+		// newest own task first since its data is most likely still in the cache
+		if (worker != NULL)
+		{
+			queueLock.acquire(&worker->mutex);
+			if (worker->tasks.size() > 0)
+			{
+				task = worker->tasks.back();
+				worker->tasks.pop_back();
+				queueLock.release();
+				this->_onTaken();
+				return task;
+			}
+			queueLock.release();
+		}
+		Mutex::ScopeLock lock(&this->mutex);
+		if (this->tasks.size() > 0)
+		{
+			task = this->tasks.front();
+			this->tasks.pop_front();
+			--this->queued;
+			return task;
+		}
+		lock.release();
+		// steal the oldest task from another worker, starting with the next one so workers don't all steal from the same one
+		int size = this->workers.size();
+		int start = (worker != NULL ? worker->index + 1 : 0);
+		Worker* other = NULL;
+		for_iter (i, 0, size)
+		{
+			other = this->workers[(start + i) % size];
+			if (other != worker)
+			{
+				queueLock.acquire(&other->mutex);
+				if (other->tasks.size() > 0)
+				{
+					task = other->tasks.front();
+					other->tasks.pop_front();
+					queueLock.release();
+					this->_onTaken();
+					return task;
+				}
+				queueLock.release();
+			}
+		}
+		return NULL;
+	}
+
+	void ThreadPool::_execute(_Task* task)
+	{
+		try
+		{
+			task->execute();
+		}
+		catch (...)
+		{
+			task->state->exception = std::current_exception();
+		}
+		Mutex::ScopeLock lock(&this->mutex);
+		task->state->finished = true;
+		--this->pending;
+		if (this->waiting > 0)
+		{
+			this->condition.broadcast();
+		}
+		lock.release();
+		delete task;
+	}
+
+	bool ThreadPool::_isFinished(_TaskState* state)
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		return state->finished;
+	}
+
+	void ThreadPool::_wait(_TaskState* state)
+	{
+		Worker* worker = this->_getCurrentWorker();
+		Mutex::ScopeLock lock(&this->mutex);
+		while (!state->finished)
+		{
+			this->_executeOrBlock(worker, &lock);
+		}
+	}
+
+	void ThreadPool::_executeOrBlock(Worker* worker, Mutex::ScopeLock* lock)
+	{
+		if (this->queued > 0)
+		{
+			lock->release();
+			this->_executeNext(worker);
+			lock->acquire(&this->mutex);
+			return;
+		}
+		++this->waiting;
+		this->condition.wait(lock);
+		--this->waiting;
+	}
+
+	ThreadPool::Worker* ThreadPool::_getCurrentWorker()
+	{
+		Worker* worker = (Worker*)_currentWorker;
+		return (worker != NULL && worker->pool == this ? worker : NULL);
+	}
+
+	void ThreadPool::_onTaken()
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		--this->queued;
+	}
+
+	ThreadPool::ThreadPool(const ThreadPool& other)
+	{
+		throw ObjectCannotCopyException("hltypes::ThreadPool");
+	}
+
+	ThreadPool& ThreadPool::operator=(ThreadPool& other)
+	{
+		throw ObjectCannotAssignException("hltypes::ThreadPool");
+		return (*this);
+	}
+
+}
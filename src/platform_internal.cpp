@@ -10,18 +10,17 @@
 
 #ifdef _WIN32
 	#include <direct.h>
+	#include <io.h>
 	#include "msvc_dirent.h"
 	#define WINDOWS_TICK 10000000ULL
 	#define SEC_TO_UNIX_EPOCH 11644473600ULL
 #else
+	#include <errno.h>
 	#include <stdlib.h>
 	#include <dirent.h>
 	#include <sys/stat.h>
 	#include <sys/types.h>
 	#include <unistd.h>
-	#if defined(__ANDROID__) || defined(__APPLE__)
-		#include <errno.h>
-	#endif
 #endif
 
 #define __HL_INCLUDE_PLATFORM_HEADERS
@@ -164,6 +163,154 @@ namespace hltypes
 		return (int)fwrite(buffer, elementSize, elementCount, (FILE*)file);
 	}
 
+	void* _platformOpenPositionalFile(const String& name, bool write)
+	{
+#ifdef _WIN32
+		DWORD access = (write ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ);
+		DWORD share = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+#ifndef _UWP
+		HANDLE handle = CreateFileW(name.wStr().c_str(), access, share, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+#else
+		HANDLE handle = CreateFile2(name.wStr().c_str(), access, share, OPEN_EXISTING, NULL);
+#endif
+		return (handle != INVALID_HANDLE_VALUE ? (void*)handle : NULL);
+#else
+		// pread() and pwrite() already leave the file position alone
+		(void)name;
+		(void)write;
+		return NULL;
+#endif
+	}
+
+	void _platformClosePositionalFile(void* handle)
+	{
+#ifdef _WIN32
+		CloseHandle((HANDLE)handle);
+#else
+		(void)handle;
+#endif
+	}
+
+#ifdef _WIN32
+	static HANDLE _getPositionalHandle(_platformFile* file, void* positionalHandle)
+	{
+		if (positionalHandle != NULL)
+		{
+			return (HANDLE)positionalHandle;
+		}
+		// synchronous handles still use the offset from OVERLAPPED, but this also moves the file pointer of the stream
+		return (HANDLE)_get_osfhandle(_fileno((FILE*)file));
+	}
+
+	static void _setOverlappedOffset(OVERLAPPED* overlapped, int64_t offset)
+	{
+		memset(overlapped, 0, sizeof(OVERLAPPED));
+		overlapped->Offset = (DWORD)(offset & 0xFFFFFFFFLL);
+		overlapped->OffsetHigh = (DWORD)(offset >> 32);
+	}
+#else
+	static inline ssize_t _pread(int descriptor, void* buffer, size_t count, int64_t offset)
+	{
+#if defined(__ANDROID__) && !defined(__LP64__)
+		// off_t has only 32 bits on 32-bit Android so offsets above 2 GB need the 64-bit variant
+		return pread64(descriptor, buffer, count, (off64_t)offset);
+#else
+		return pread(descriptor, buffer, count, (off_t)offset);
+#endif
+	}
+
+	static inline ssize_t _pwrite(int descriptor, const void* buffer, size_t count, int64_t offset)
+	{
+#if defined(__ANDROID__) && !defined(__LP64__)
+		return pwrite64(descriptor, buffer, count, (off64_t)offset);
+#else
+		return pwrite(descriptor, buffer, count, (off_t)offset);
+#endif
+	}
+#endif
+
+	int _platformReadFileAt(void* buffer, int count, int64_t offset, _platformFile* file, void* positionalHandle)
+	{
+		int result = 0;
+#ifdef _WIN32
+		HANDLE handle = _getPositionalHandle(file, positionalHandle);
+		if (handle == INVALID_HANDLE_VALUE)
+		{
+			return 0;
+		}
+		OVERLAPPED overlapped;
+		DWORD read = 0;
+		while (result < count)
+		{
+			_setOverlappedOffset(&overlapped, offset + result);
+			if (ReadFile(handle, (unsigned char*)buffer + result, (DWORD)(count - result), &read, &overlapped) == 0 || read == 0)
+			{
+				break;
+			}
+			result += (int)read;
+		}
+#else
+		(void)positionalHandle; // pread() doesn't need a separate handle
+		int descriptor = fileno((FILE*)file);
+		ssize_t read = 0;
+		while (result < count)
+		{
+			read = _pread(descriptor, (unsigned char*)buffer + result, (size_t)(count - result), offset + result);
+			if (read < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			if (read <= 0)
+			{
+				break;
+			}
+			result += (int)read;
+		}
+#endif
+		return result;
+	}
+
+	int _platformWriteFileAt(const void* buffer, int count, int64_t offset, _platformFile* file, void* positionalHandle)
+	{
+		int result = 0;
+#ifdef _WIN32
+		HANDLE handle = _getPositionalHandle(file, positionalHandle);
+		if (handle == INVALID_HANDLE_VALUE)
+		{
+			return 0;
+		}
+		OVERLAPPED overlapped;
+		DWORD written = 0;
+		while (result < count)
+		{
+			_setOverlappedOffset(&overlapped, offset + result);
+			if (WriteFile(handle, (const unsigned char*)buffer + result, (DWORD)(count - result), &written, &overlapped) == 0 || written == 0)
+			{
+				break;
+			}
+			result += (int)written;
+		}
+#else
+		(void)positionalHandle; // pwrite() doesn't need a separate handle
+		int descriptor = fileno((FILE*)file);
+		ssize_t written = 0;
+		while (result < count)
+		{
+			written = _pwrite(descriptor, (const unsigned char*)buffer + result, (size_t)(count - result), offset + result);
+			if (written < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			if (written <= 0)
+			{
+				break;
+			}
+			result += (int)written;
+		}
+#endif
+		return result;
+	}
+
 	int64_t _platformGetFilePosition(_platformFile* file)
 	{
 		fpos_t position = 0;
@@ -40,6 +40,10 @@ namespace hltypes
 	void _platformCloseFile(_platformFile* file);
 	int _platformReadFile(void* buffer, int elementSize, int elementCount, _platformFile* file);
 	int _platformWriteFile(const void* buffer, int elementSize, int elementCount, _platformFile* file);
+	void* _platformOpenPositionalFile(const String& name, bool write);
+	void _platformClosePositionalFile(void* handle);
+	int _platformReadFileAt(void* buffer, int count, int64_t offset, _platformFile* file, void* positionalHandle);
+	int _platformWriteFileAt(const void* buffer, int count, int64_t offset, _platformFile* file, void* positionalHandle);
 	int64_t _platformGetFilePosition(_platformFile* file);
 	bool _platformSeekFile(_platformFile* file, int64_t size, int64_t position, int64_t offset, StreamBase::SeekMode seekMode);
 	bool _platformFileExists(const String& name);
@@ -13,7 +13,7 @@
 
 #include "harray.h"
 #include "hfbase.h"
-#include "hmap.h"
+#include "hflatmap.h"
 #include "hmutex.h"
 #include "hrdir.h"
 #include "hresource.h"
@@ -109,14 +109,14 @@ namespace hltypes
 
 		// keeping track of all mounts
 		static Mutex accessMutex;
-		static Map<String, ArchiveFileHandle*> pathMounts;
+		static FlatMap<String, ArchiveFileHandle*> pathMounts;
 
 		// utility methods
 		inline ArchiveFileHandle* _aopen(String& filename)
 		{
 			String longestPath;
 			ArchiveFileHandle* result = NULL;
-			foreach_m (ArchiveFileHandle*, it, pathMounts)
+			for (FlatMap<String, ArchiveFileHandle*>::iterator_t it = pathMounts.begin(), itEnd = pathMounts.end(); it != itEnd; ++it)
 			{
 				if (it->first != "" && filename.startsWith(it->first) && (result == NULL || it->first.size() > longestPath.size()))
 				{
@@ -306,7 +306,7 @@ namespace hltypes
 			unsigned int size = 0;
 			String path;
 			Mutex::ScopeLock lock(&accessMutex);
-			foreach_m (ArchiveFileHandle*, it, pathMounts)
+			for (FlatMap<String, ArchiveFileHandle*>::iterator_t it = pathMounts.begin(), itEnd = pathMounts.end(); it != itEnd; ++it)
 			{
 				if (it->second->internalFiles.size() == 0)
 				{
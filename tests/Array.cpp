@@ -1,8 +1,11 @@
 #define _HTEST_LIB hltypes
 #define _HTEST_CLASS Array
 #include <htest/htest.h>
+#include <type_traits>
+#include <vector>
 
 #include "harray.h"
+#include "hsmallarray.h"
 
 HTEST_SUITE_BEGIN
 
@@ -180,6 +183,32 @@ HTEST_CASE(removing2)
 	HTEST_ASSERT(a == b, "");
 }
 
+HTEST_CASE(removing3)
+{
+	harray<int> a;
+	for_iter (i, 0, 7)
+	{
+		a += i;
+	}
+	HTEST_ASSERT(a.removeAtUnordered(1) == 1, "");
+	HTEST_ASSERT(a.size() == 6 && a[1] == 6 && a[5] == 5, "");
+	HTEST_ASSERT(a.removeAtUnordered(-1) == 5, "");
+	HTEST_ASSERT(a.size() == 5 && a.last() == 4, "");
+	a.removeUnordered(0);
+	HTEST_ASSERT(a.size() == 4 && a[0] == 4 && a[1] == 6, "");
+	a.removeUnordered(3);
+	HTEST_ASSERT(a.size() == 3 && a[0] == 4 && a[1] == 6 && a[2] == 2, "");
+	HTEST_ASSERT(a.removeIf([](int const& i) { return (i % 2 == 0); }) == 3, "");
+	HTEST_ASSERT(a.size() == 0, "");
+	for_iter (i, 0, 10)
+	{
+		a += i;
+	}
+	HTEST_ASSERT(a.removeIf([](int const& i) { return (i % 3 == 0); }) == 4, "");
+	HTEST_ASSERT(a.size() == 6 && a[0] == 1 && a[1] == 2 && a[2] == 4 && a[5] == 8, "");
+	HTEST_ASSERT(a.removeIf([](int const& i) { return (i > 100); }) == 0, "");
+}
+
 HTEST_CASE(container)
 {
 	harray<int> a;
@@ -384,6 +413,46 @@ HTEST_CASE(difference)
 	HTEST_ASSERT((a1 / a2).size() == 0, "");
 }
 
+struct Unhashable
+{
+	int value;
+	Unhashable(int value = 0) : value(value) { }
+	bool operator==(const Unhashable& other) const { return (this->value == other.value); }
+};
+
+HTEST_CASE(setOperations)
+{
+	harray<hstr> a = hstr("b,a,b,c,a,d").split(',');
+	harray<hstr> b = hstr("c,x,a").split(',');
+	HTEST_ASSERT(a.removedDuplicates() == hstr("b,a,c,d").split(','), "removedDuplicates()");
+	HTEST_ASSERT(a.intersected(b) == hstr("a,c,a").split(','), "intersected()");
+	HTEST_ASSERT(a.differentiated(b) == hstr("b,b,d").split(','), "differentiated()");
+	HTEST_ASSERT(a.united(b) == hstr("b,a,c,d,x").split(','), "united()");
+	harray<Unhashable> c;
+	c += Unhashable(3);
+	c += Unhashable(1);
+	c += Unhashable(3);
+	c += Unhashable(2);
+	c += Unhashable(1);
+	c.removeDuplicates();
+	HTEST_ASSERT(c.size() == 3 && c[0].value == 3 && c[1].value == 1 && c[2].value == 2, "removeDuplicates() without Hash");
+	harray<Unhashable> d;
+	d += Unhashable(1);
+	HTEST_ASSERT(c.intersected(d).size() == 1 && c.differentiated(d).size() == 2, "intersected()/differentiated() without Hash");
+	harray<hstr> e = a;
+	e.intersect(e);
+	HTEST_ASSERT(e == a, "intersect() with itself");
+	e.differentiate(e);
+	HTEST_ASSERT(e.size() == 0, "differentiate() with itself");
+	harray<int> large;
+	for_iter (i, 0, 200000)
+	{
+		large += i % 1000;
+	}
+	large.removeDuplicates();
+	HTEST_ASSERT(large.size() == 1000 && large.first() == 0 && large.last() == 999, "removeDuplicates() large");
+}
+
 HTEST_CASE(random)
 {
 	harray<int> a;
@@ -456,6 +525,46 @@ HTEST_CASE(matching)
 	HTEST_ASSERT(c.matchesAll(&positive) == false, "");
 }
 
+class CountingLess
+{
+public:
+	int* calls;
+
+	CountingLess(int* calls) : calls(calls) { }
+	bool operator()(int const& a, int const& b) const { ++(*this->calls); return (a < b); }
+
+};
+
+HTEST_CASE(callables)
+{
+	harray<int> a;
+	a += 3;
+	a += -1;
+	a += 2;
+	a += -3;
+	int limit = 1;
+	HTEST_ASSERT(a.count([limit](int const& i) { return (i > limit); }) == 2, "");
+	HTEST_ASSERT(a.count(2) == 1, "");
+	HTEST_ASSERT(a.matchesAny([](int const& i) { return (i == 2); }), "");
+	HTEST_ASSERT(!a.matchesAll([limit](int const& i) { return (i < limit); }), "");
+	HTEST_ASSERT(*a.findFirst([](int const& i) { return (i < 0); }) == -1, "");
+	harray<int> b = a.findAll([limit](int const& i) { return (i > limit); });
+	HTEST_ASSERT(b.size() == 2 && b[0] == 3 && b[1] == 2, "");
+	harray<hstr> c = a.mapped([](int const& i) { return hstr(i * 2); });
+	HTEST_ASSERT(c.size() == 4 && c[0] == "6" && c[3] == "-6", "");
+	HTEST_ASSERT(a.mapped(&negative).size() == 4, "");
+	int calls = 0;
+	a.sort(CountingLess(&calls));
+	HTEST_ASSERT(calls > 0, "");
+	HTEST_ASSERT(a[0] == -3 && a[1] == -1 && a[2] == 2 && a[3] == 3, "");
+	b = a.sorted([](int const& x, int const& y) { return (x > y); });
+	HTEST_ASSERT(b[0] == 3 && b[3] == -3, "");
+	HTEST_ASSERT(a.max([](int const& x, int const& y) { return (hsgn(x) < hsgn(y)); }) == 2, "");
+	int sum = 0;
+	a.each([&sum](int const& i) { sum += i; });
+	HTEST_ASSERT(sum == 1, "");
+}
+
 HTEST_CASE(cast)
 {
 	harray<int> a;
@@ -583,4 +692,135 @@ HTEST_CASE(outOfBoundsAssignment)
 	HTEST_ASSERT(false, "");
 }
 
+struct Point
+{
+	int x;
+	int y;
+	Point(int x, int y) : x(x), y(y) { }
+	bool operator==(const Point& other) const { return (this->x == other.x && this->y == other.y); }
+};
+
+HTEST_CASE(move)
+{
+	harray<hstr> a;
+	hstr text('x', 100);
+	const char* data = text.cStr();
+	a.add(std::move(text));
+	HTEST_ASSERT(a.first().cStr() == data, "add(T&&)");
+	a += hstr("b");
+	a.insertAt(0, hstr("c"));
+	HTEST_ASSERT(a.size() == 3 && a.first() == "c" && a.last() == "b", "insertAt(T&&)");
+	hstr removed = a.removeAt(1);
+	HTEST_ASSERT(removed.cStr() == data, "removeAt()");
+	harray<hstr> b = std::move(a);
+	HTEST_ASSERT(b.size() == 2 && a.size() == 0, "move constructor");
+	a = std::move(b);
+	HTEST_ASSERT(a.size() == 2 && b.size() == 0, "move assignment");
+	HTEST_ASSERT((std::is_nothrow_move_constructible<harray<hstr> >::value), "noexcept move constructor");
+	HTEST_ASSERT((std::is_nothrow_move_assignable<harray<hstr> >::value), "noexcept move assignment");
+	HTEST_ASSERT((std::is_nothrow_move_constructible<hsmallarray<hstr, 4> >::value), "noexcept SmallArray move constructor");
+	// reallocating a std::vector has to move the arrays instead of copying them
+	std::vector<harray<hstr> > arrays;
+	arrays.push_back(a);
+	const hstr* elements = &arrays[0].first();
+	for_iter (i, 0, 100)
+	{
+		arrays.push_back(harray<hstr>());
+	}
+	HTEST_ASSERT(&arrays[0].first() == elements, "std::vector reallocation");
+	HTEST_ASSERT(hstr("c,a,b").split(',').sorted() == hstr("a,b,c").split(','), "sorted() &&");
+	HTEST_ASSERT(hstr("c,a,b").split(',').reversed() == hstr("b,a,c").split(','), "reversed() &&");
+	harray<Point> points;
+	points.emplace(1, 2);
+	points.emplaceAt(0, 3, 4);
+	HTEST_ASSERT(points.size() == 2 && points[0] == Point(3, 4) && points[1] == Point(1, 2), "emplace()");
+}
+
+HTEST_CASE(smallArray)
+{
+	hsmallarray<hstr, 4> a;
+	a += "a";
+	a += "b";
+	a += "c";
+	const hstr* data = &a[0];
+	a += "d";
+	HTEST_ASSERT(&a[0] == data, "inline storage");
+	a += "e";
+	HTEST_ASSERT(a.size() == 5 && a.first() == "a" && a.last() == "e", "heap storage");
+	hsmallarray<hstr, 4> b(a);
+	HTEST_ASSERT(b == a, "copy");
+	hsmallarray<hstr, 4> c(std::move(b));
+	HTEST_ASSERT(c == a && b.size() == 0, "move");
+	c.remove("e");
+	c.removeAt(3);
+	b = std::move(c);
+	HTEST_ASSERT(b.size() == 3 && b.joined(",") == "a,b,c", "move assignment");
+	b = b.reversed();
+	HTEST_ASSERT(b.joined(",") == "c,b,a", "reversed()");
+	harray<hstr> d = b.toArray();
+	HTEST_ASSERT(d.size() == 3 && d.first() == "c", "toArray()");
+	HTEST_ASSERT((hsmallarray<hstr, 4>(d) == b), "from Array");
+	hsmallarray<hstr, 4> e(std::move(b));
+	HTEST_ASSERT(e.joined(",") == "c,b,a" && b.size() == 0, "move from inline storage");
+	b += "x";
+	HTEST_ASSERT(e.size() == 3 && b.size() == 1, "move from inline storage");
+	e.insertAt(1, e[2]);
+	e.insertAt(0, e.last(), 3);
+	HTEST_ASSERT(e.joined(",") == "a,a,a,c,a,b,a", "insertAt() with own elements");
+	e.insertAt(2, e);
+	HTEST_ASSERT(e.size() == 14 && e.joined(",") == "a,a,a,a,a,c,a,b,a,a,c,a,b,a", "insertAt() with itself");
+	e.removeAt(1, 10);
+	HTEST_ASSERT(e.joined(",") == "a,a,b,a", "removeAt()");
+}
+
+static bool _isEven(int const& value)
+{
+	return (value % 2 == 0);
+}
+
+static int _halved(int const& value)
+{
+	return (value / 2);
+}
+
+static bool _lessByTens(int const& a, int const& b)
+{
+	return (a / 10 < b / 10);
+}
+
+static void _sortNested(int index, void* data)
+{
+	(*(harray<harray<int> >*)data)[index].sortParallel();
+}
+
+HTEST_CASE(parallel)
+{
+	harray<int> a;
+	for_iter (i, 0, 100000)
+	{
+		a += (i * 7919) % 100003;
+	}
+	harray<int> b = a;
+	b.sort();
+	harray<int> c = a;
+	c.sortParallel();
+	HTEST_ASSERT(b == c, "sortParallel()");
+	b = a;
+	b.sort(&_lessByTens);
+	c = a;
+	c.sortParallel(&_lessByTens);
+	HTEST_ASSERT(b == c, "sortParallel(compareFunction) has to be stable");
+	HTEST_ASSERT(a.countParallel(&_isEven) == a.count(&_isEven), "countParallel()");
+	HTEST_ASSERT(a.findAllParallel(&_isEven) == a.findAll(&_isEven), "findAllParallel()");
+	HTEST_ASSERT(a.mappedParallel(&_halved) == a.mapped(&_halved), "mappedParallel()");
+	harray<int> small(a, 100);
+	HTEST_ASSERT(small.mappedParallel(&_halved) == small.mapped(&_halved), "serial fallback");
+	// parallel calls made from within parallel calls run on the same pool
+	harray<harray<int> > arrays(a, 4);
+	hparallel::run(&_sortNested, &arrays, arrays.size());
+	b = a;
+	b.sort();
+	HTEST_ASSERT(arrays[0] == b && arrays[1] == b && arrays[2] == b && arrays[3] == b, "nested");
+}
+
 HTEST_SUITE_END
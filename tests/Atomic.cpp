@@ -0,0 +1,233 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS Atomic
+#include <htest/htest.h>
+#include "hatomic.h"
+#include "hlatch.h"
+#include "hmpmcqueue.h"
+#include "hspscqueue.h"
+#include "hthread.h"
+
+#define PRODUCER_COUNT 4
+#define CONSUMER_COUNT 4
+#define ELEMENT_COUNT 10000
+
+static hatomic<int> counter;
+static hmpmcqueue<int>* mpmcQueue1 = NULL;
+static hspscqueue<int>* spscQueue1 = NULL;
+static hatomic<int> producerIndex;
+static hatomic<long long> consumedSum;
+static hatomic<int> consumedCount;
+static bool ordered = true;
+static hlatch* finished = NULL;
+
+static void _increment(hthread* t)
+{
+	for (int i = 0; i < ELEMENT_COUNT; ++i)
+	{
+		++counter;
+	}
+	finished->countDown();
+}
+
+static void _mpmcProducer(hthread* t)
+{
+	int index = producerIndex++;
+	for (int i = index; i < ELEMENT_COUNT * PRODUCER_COUNT; i += PRODUCER_COUNT)
+	{
+		while (!mpmcQueue1->push(i))
+		{
+			hthread::sleep(0.0f);
+		}
+	}
+	finished->countDown();
+}
+
+static void _mpmcConsumer(hthread* t)
+{
+	int value = 0;
+	while (consumedCount.load() < ELEMENT_COUNT * PRODUCER_COUNT)
+	{
+		if (mpmcQueue1->pop(value))
+		{
+			consumedSum.fetchAdd(value);
+			++consumedCount;
+		}
+	}
+	finished->countDown();
+}
+
+static void _spscProducer(hthread* t)
+{
+	for (int i = 0; i < ELEMENT_COUNT; ++i)
+	{
+		spscQueue1->push(i);
+	}
+	finished->countDown();
+}
+
+static void _spscConsumer(hthread* t)
+{
+	int value = 0;
+	int expected = 0;
+	while (expected < ELEMENT_COUNT)
+	{
+		if (spscQueue1->pop(value))
+		{
+			if (value != expected)
+			{
+				ordered = false;
+			}
+			++expected;
+		}
+	}
+	finished->countDown();
+}
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(operations)
+{
+	hatomic<int> a(5);
+	HTEST_ASSERT(a.load() == 5, "");
+	a.store(7, std::memory_order_release);
+	HTEST_ASSERT(a.load(std::memory_order_acquire) == 7, "");
+	HTEST_ASSERT(a.exchange(3) == 7, "");
+	int expected = 4;
+	HTEST_ASSERT(!a.compareExchange(expected, 10), "");
+	HTEST_ASSERT(expected == 3, "");
+	HTEST_ASSERT(a.compareExchange(expected, 10), "");
+	HTEST_ASSERT(a == 10, "");
+	// a weaker success order has to work without passing a failure order
+	expected = 9;
+	HTEST_ASSERT(!a.compareExchange(expected, 11, std::memory_order_release), "");
+	HTEST_ASSERT(expected == 10, "");
+	HTEST_ASSERT(a.compareExchange(expected, 11, std::memory_order_acq_rel), "");
+	while (!a.compareExchangeWeak(expected, 10, std::memory_order_relaxed))
+	{
+	}
+	HTEST_ASSERT(a == 10, "");
+	HTEST_ASSERT(a.fetchAdd(5) == 10, "");
+	HTEST_ASSERT(a.fetchSub(3) == 15, "");
+	HTEST_ASSERT(++a == 13, "");
+	HTEST_ASSERT(a-- == 13, "");
+	HTEST_ASSERT(a.fetchOr(0x10) == 12, "");
+	HTEST_ASSERT(a.fetchAnd(0x18) == 28, "");
+	HTEST_ASSERT(a.fetchXor(0x18) == 24, "");
+	HTEST_ASSERT(a == 0, "");
+	hatomic<bool> b;
+	HTEST_ASSERT(!b, "");
+	b = true;
+	HTEST_ASSERT(b && b.isLockFree(), "");
+	int values[2] = {1, 2};
+	hatomic<int*> p(values);
+	HTEST_ASSERT(*p.fetchAdd(1) == 1 && *p.load() == 2, "");
+}
+
+HTEST_CASE(concurrentIncrement)
+{
+	counter = 0;
+	hlatch latch(4);
+	finished = &latch;
+	hthread* t[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		t[i] = new hthread(&_increment);
+		t[i]->start();
+	}
+	latch.wait();
+	for (int i = 0; i < 4; ++i)
+	{
+		t[i]->join();
+		delete t[i];
+	}
+	HTEST_ASSERT(counter == ELEMENT_COUNT * 4, hstr(counter.load()).cStr());
+}
+
+HTEST_CASE(mpmcQueue)
+{
+	hmpmcqueue<int> queue(5);
+	HTEST_ASSERT(queue.getCapacity() == 8, "");
+	HTEST_ASSERT(queue.isEmpty(), "");
+	int value = 0;
+	HTEST_ASSERT(!queue.pop(value), "");
+	for (int i = 0; i < 8; ++i)
+	{
+		HTEST_ASSERT(queue.push(i), "");
+	}
+	HTEST_ASSERT(!queue.push(8), "full");
+	HTEST_ASSERT(queue.size() == 8, "");
+	HTEST_ASSERT(queue.pop(value) && value == 0, "");
+	HTEST_ASSERT(queue.push(8), "");
+	for (int i = 1; i <= 8; ++i)
+	{
+		HTEST_ASSERT(queue.pop(value) && value == i, "");
+	}
+	HTEST_ASSERT(queue.isEmpty(), "");
+}
+
+HTEST_CASE(mpmcQueueThreads)
+{
+	hmpmcqueue<int> queue(64);
+	mpmcQueue1 = &queue;
+	producerIndex = 0;
+	consumedSum = 0;
+	consumedCount = 0;
+	hlatch latch(PRODUCER_COUNT + CONSUMER_COUNT);
+	finished = &latch;
+	hthread* t[PRODUCER_COUNT + CONSUMER_COUNT];
+	for (int i = 0; i < PRODUCER_COUNT; ++i)
+	{
+		t[i] = new hthread(&_mpmcProducer);
+	}
+	for (int i = PRODUCER_COUNT; i < PRODUCER_COUNT + CONSUMER_COUNT; ++i)
+	{
+		t[i] = new hthread(&_mpmcConsumer);
+	}
+	for (int i = 0; i < PRODUCER_COUNT + CONSUMER_COUNT; ++i)
+	{
+		t[i]->start();
+	}
+	latch.wait();
+	for (int i = 0; i < PRODUCER_COUNT + CONSUMER_COUNT; ++i)
+	{
+		t[i]->join();
+		delete t[i];
+	}
+	long long count = ELEMENT_COUNT * PRODUCER_COUNT;
+	HTEST_ASSERT(consumedCount == count, "");
+	HTEST_ASSERT(consumedSum == count * (count - 1) / 2, "sum");
+}
+
+HTEST_CASE(spscQueue)
+{
+	hspscqueue<hstr> queue;
+	hstr value;
+	HTEST_ASSERT(queue.isEmpty() && !queue.pop(value), "");
+	queue.push("a");
+	queue.push(hstr("b"));
+	HTEST_ASSERT(queue.pop(value) && value == "a", "");
+	queue.push("c");
+	HTEST_ASSERT(queue.pop(value) && value == "b", "");
+	HTEST_ASSERT(queue.pop(value) && value == "c", "");
+	HTEST_ASSERT(queue.isEmpty(), "");
+}
+
+HTEST_CASE(spscQueueThreads)
+{
+	hspscqueue<int> queue;
+	spscQueue1 = &queue;
+	ordered = true;
+	hlatch latch(2);
+	finished = &latch;
+	hthread producer(&_spscProducer);
+	hthread consumer(&_spscConsumer);
+	producer.start();
+	consumer.start();
+	latch.wait();
+	producer.join();
+	consumer.join();
+	HTEST_ASSERT(ordered, "");
+	HTEST_ASSERT(queue.isEmpty(), "");
+}
+
+HTEST_SUITE_END
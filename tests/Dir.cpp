@@ -96,4 +96,10 @@ HTEST_CASE_WITH_DATA(staticCopy)
 	hdir::remove(newdir + "/" + dirTemplate);
 }
 
+HTEST_CASE(systemize)
+{
+	HTEST_ASSERT(hdir::systemize("a\\b//c///d") == "a/b/c/d", "systemize 1");
+	HTEST_ASSERT(hdir::systemize("a/b/") == "a/b/", "systemize 2");
+}
+
 HTEST_SUITE_END
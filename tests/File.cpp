@@ -2,8 +2,10 @@
 #define _HTEST_CLASS File
 #include <htest/htest.h>
 #include "harray.h"
+#include "hatomic.h"
 #include "hexception.h"
 #include "hfile.h"
+#include "hmutex.h"
 #include "hstring.h"
 
 HTEST_SUITE_BEGIN
@@ -101,6 +103,85 @@ HTEST_CASE_WITH_DATA(readWriteRaw)
 	hfile::remove(filename);
 }
 
+HTEST_CASE_WITH_DATA(readAtWriteAt)
+{
+	hstr filename = tempDir + "/positional.txt";
+	hfile f;
+	f.open(filename, hfaccess::ReadWriteCreate);
+	f.write("0123");
+	f.close();
+	f.open(filename, hfaccess::ReadWrite);
+	f.seek(2, hseek::Start);
+	hthreadpool pool(4);
+	hatomic<int> sizeErrors(0);
+	pool.parallelFor(0, 64, 1, [&f, &sizeErrors](int i)
+	{
+		unsigned char value = (unsigned char)i;
+		f.writeAt(4 + i, &value, 1);
+		// the size can be read while other threads are still growing it
+		if (f.size() < (int64_t)(5 + i))
+		{
+			++sizeErrors;
+		}
+	});
+	HTEST_ASSERT(sizeErrors == 0, "");
+	HTEST_ASSERT(f.size() == (int64_t)68, "");
+	HTEST_ASSERT(f.position() == 2, "");
+	harray<int> errors;
+	hmutex errorMutex;
+	pool.parallelFor(0, 64, 1, [&f, &errors, &errorMutex](int i)
+	{
+		unsigned char value = 0;
+		if (f.readAt(4 + i, &value, 1) != 1 || value != (unsigned char)i)
+		{
+			hmutex::ScopeLock lock(&errorMutex);
+			errors += i;
+		}
+	});
+	HTEST_ASSERT(errors.size() == 0, "");
+	char text[4] = { '\0' };
+	HTEST_ASSERT(f.readAt(1, text, 3) == 3, "");
+	HTEST_ASSERT(hstr(text) == "123", "");
+	HTEST_ASSERT(f.position() == 2, "");
+	HTEST_ASSERT(f.read(2) == "23", "");
+	f.close();
+	hfile::remove(filename);
+}
+
+HTEST_CASE_WITH_DATA(readAsync)
+{
+	hstr filename = tempDir + "/async.txt";
+	hfile f;
+	f.open(filename, hfaccess::Write);
+	f.write("This is an asynchronous test.");
+	f.open(filename, hfaccess::Read);
+	f.seek(5, hseek::Start);
+	char a[8] = { '\0' };
+	char b[8] = { '\0' };
+	char c[8] = { '\0' };
+	hatomic<int> callbackCount(0);
+	hthreadpool::Future<int> futureA = f.readAsync(0, a, 4);
+	hthreadpool::Future<int> futureB = f.readAsync(11, b, 7);
+	hthreadpool::Future<void> futureC = f.readAsync(25, c, 7, [&callbackCount](int count)
+	{
+		if (count == 4)
+		{
+			++callbackCount;
+		}
+	});
+	HTEST_ASSERT(futureA.get() == 4, "");
+	HTEST_ASSERT(futureB.get() == 7, "");
+	futureC.get();
+	HTEST_ASSERT(callbackCount == 1, "");
+	HTEST_ASSERT(hstr(a) == "This", "");
+	HTEST_ASSERT(hstr(b) == "asynchr", "");
+	HTEST_ASSERT(hstr(c) == "est.", "");
+	HTEST_ASSERT(f.position() == 5, "");
+	HTEST_ASSERT(f.read(2) == "is", "");
+	f.close();
+	hfile::remove(filename);
+}
+
 HTEST_CASE_WITH_DATA(seekPositionSize)
 {
 	hstr filename = tempDir + "/test.txt";
@@ -0,0 +1,105 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS FlatMap
+#include <htest/htest.h>
+#include "harray.h"
+#include "hflatmap.h"
+#include "hmap.h"
+#include "hstring.h"
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(adding)
+{
+	hflatmap<hstr, int> a;
+	a["test"] = 7;
+	a["a"] = 1;
+	a["abc"] = 2;
+	HTEST_ASSERT(a.size() == 3, "");
+	HTEST_ASSERT(a["a"] == 1, "");
+	HTEST_ASSERT(a["abc"] == 2, "");
+	HTEST_ASSERT(a["test"] == 7, "");
+	HTEST_ASSERT(a.valueOf("a") == 1, "");
+	HTEST_ASSERT(a(2) == "abc", "");
+	HTEST_ASSERT(a.hasValue(1), "");
+	HTEST_ASSERT(!a.hasValue(6), "");
+	HTEST_ASSERT(a.hasKey("abc"), "");
+	HTEST_ASSERT(!a.hasKey("key"), "");
+	HTEST_ASSERT(a.tryGet("key", -1) == -1, "");
+	a.insert("a", 5);
+	HTEST_ASSERT(a["a"] == 5, "");
+	HTEST_ASSERT(a.size() == 3, "");
+	harray<hstr> keys = a.keys();
+	HTEST_ASSERT(keys.size() == 3 && keys[0] == "a" && keys[1] == "abc" && keys[2] == "test", "");
+	HTEST_ASSERT(a.lowerBound("ab")->first == "abc", "");
+	HTEST_ASSERT(a.upperBound("abc")->first == "test", "");
+	HTEST_ASSERT(a.upperBound("test") == a.end(), "");
+}
+
+HTEST_CASE(removing)
+{
+	hflatmap<hstr, int> a;
+	a["a"] = 1;
+	a["abc"] = 2;
+	a["test"] = 7;
+	HTEST_ASSERT(a.removeKey("abc"), "");
+	HTEST_ASSERT(!a.removeKey("abc"), "");
+	HTEST_ASSERT(a.size() == 2, "");
+	HTEST_ASSERT(a.removeValue(7), "");
+	HTEST_ASSERT(a.size() == 1 && a.hasKey("a"), "");
+	a.clear();
+	HTEST_ASSERT(a.isEmpty(), "");
+}
+
+HTEST_CASE(building)
+{
+	hmap<int, hstr> map;
+	harray<std::pair<int, hstr> > pairs;
+	for_iter (i, 0, 100)
+	{
+		map[i * 7 % 100] = hstr(i);
+		pairs += std::pair<int, hstr>(i * 7 % 100, hstr(i));
+	}
+	pairs += std::pair<int, hstr>(50, "last");
+	hflatmap<int, hstr> a(map);
+	hflatmap<int, hstr> b(pairs);
+	HTEST_ASSERT(a.size() == 100 && b.size() == 100, "");
+	HTEST_ASSERT(b[50] == "last", "");
+	b[50] = a[50];
+	HTEST_ASSERT(a == b, "");
+	int previous = -1;
+	for (hflatmap<int, hstr>::const_iterator_t it = a.begin(); it != a.end(); ++it)
+	{
+		HTEST_ASSERT(it->first > previous, "");
+		HTEST_ASSERT(it->second == map[it->first], "");
+		previous = it->first;
+	}
+	hflatmap<int, hstr> c = a.random(10);
+	HTEST_ASSERT(c.size() == 10 && a.hasAllKeys(c.keys()), "");
+	hflatmap<int, hstr> d = b.removeRandom(10);
+	HTEST_ASSERT(d.size() == 10 && b.size() == 90 && !b.hasAnyKey(d.keys()), "");
+	b += d;
+	HTEST_ASSERT(a == b, "");
+}
+
+HTEST_CASE(merging)
+{
+	hflatmap<hstr, int> a;
+	a["a"] = 1;
+	a["c"] = 3;
+	hflatmap<hstr, int> b;
+	b["b"] = 2;
+	b["c"] = 4;
+	b["d"] = 5;
+	hflatmap<hstr, int> c = a + b;
+	HTEST_ASSERT(c.size() == 4 && c["c"] == 3, "");
+	c.inject(b);
+	HTEST_ASSERT(c.size() == 4 && c["c"] == 4, "");
+	HTEST_ASSERT((c.keys() == harray<hstr>(hstr("a,b,c,d").split(','))), "");
+	hflatmap<hstr, int> d = c.findAll([](hstr const& key, int const& value) { return (value % 2 == 0); });
+	HTEST_ASSERT(d.size() == 2 && d.hasKey("b") && d.hasKey("c"), "");
+	HTEST_ASSERT(c.matchesAll([](hstr const& key, int const& value) { return (value > 0); }), "");
+	hflatmap<int, int> e = c.cast<int, int>();
+	HTEST_ASSERT(e.size() == 1 && e[0] == 5, "");
+}
+
+HTEST_SUITE_END
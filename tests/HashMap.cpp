@@ -0,0 +1,201 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS HashMap
+#include <htest/htest.h>
+#include <type_traits>
+#include "harray.h"
+#include "hhashmap.h"
+#include "hstring.h"
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(adding)
+{
+	hhashmap<hstr, int> a;
+	a["a"] = 1;
+	a["abc"] = 2;
+	a["test"] = 7;
+	HTEST_ASSERT(a.size() == 3, "");
+	HTEST_ASSERT(a["a"] == 1, "");
+	HTEST_ASSERT(a["abc"] == 2, "");
+	HTEST_ASSERT(a["test"] == 7, "");
+	HTEST_ASSERT(a.valueOf("a") == 1, "");
+	HTEST_ASSERT(a.valueOf("test") == 7, "");
+	HTEST_ASSERT(a(2) == "abc", "");
+	HTEST_ASSERT(a.keyOf(7) == "test", "");
+	HTEST_ASSERT(a.hasValue(1), "");
+	HTEST_ASSERT(!a.hasValue(6), "");
+	HTEST_ASSERT(a.hasKey("abc"), "");
+	HTEST_ASSERT(!a.hasKey("key"), "");
+	HTEST_ASSERT(a.tryGet("key", -1) == -1, "");
+	a.insert("a", 5);
+	HTEST_ASSERT(a["a"] == 5, "");
+	HTEST_ASSERT(a.size() == 3, "");
+	harray<hstr> keys = a.keys();
+	HTEST_ASSERT(keys.size() == 3, "");
+	HTEST_ASSERT(keys.has("a") && keys.has("abc") && keys.has("test"), "");
+	HTEST_ASSERT(a.hasAllKeys(keys), "");
+	keys += "not existent";
+	HTEST_ASSERT(!a.hasAllKeys(keys), "");
+	HTEST_ASSERT(a.hasAnyKey(keys), "");
+	harray<int> values = a.values(keys(0, 3));
+	HTEST_ASSERT(values.size() == 3, "");
+	HTEST_ASSERT(a.hasAllValues(values), "");
+}
+
+HTEST_CASE(removing)
+{
+	hhashmap<hstr, int> a;
+	a["a"] = 1;
+	a["abc"] = 2;
+	a["test"] = 7;
+	HTEST_ASSERT(a.removeKey("abc"), "");
+	HTEST_ASSERT(!a.removeKey("abc"), "");
+	HTEST_ASSERT(a.size() == 2, "");
+	HTEST_ASSERT(!a.hasKey("abc"), "");
+	HTEST_ASSERT(a.removeValue(7), "");
+	HTEST_ASSERT(a.size() == 1, "");
+	HTEST_ASSERT(a.hasKey("a"), "");
+	a.clear();
+	HTEST_ASSERT(a.size() == 0, "");
+	HTEST_ASSERT(!a.hasKey("a"), "");
+}
+
+HTEST_CASE(growing)
+{
+	hhashmap<int, hstr> a;
+	for_iter (i, 0, 5000)
+	{
+		a[i * 7] = hstr(i);
+	}
+	HTEST_ASSERT(a.size() == 5000, "");
+	HTEST_ASSERT(a.getCapacity() >= 5000, "");
+	bool correct = true;
+	for_iter (i, 0, 5000)
+	{
+		if (a.tryGet(i * 7, "") != hstr(i) || a.hasKey(i * 7 + 1))
+		{
+			correct = false;
+		}
+	}
+	HTEST_ASSERT(correct, "");
+	// removing every other entry makes sure backward shift deletion keeps all probe sequences intact
+	for_iter (i, 0, 2500)
+	{
+		a.removeKey(i * 14);
+	}
+	HTEST_ASSERT(a.size() == 2500, "");
+	for_iter (i, 0, 5000)
+	{
+		if (a.hasKey(i * 7) != (i % 2 == 1))
+		{
+			correct = false;
+		}
+	}
+	HTEST_ASSERT(correct, "");
+	int count = 0;
+	for (hhashmap<int, hstr>::const_iterator_t it = a.begin(); it != a.end(); ++it)
+	{
+		if (it->second != hstr(it->first / 7))
+		{
+			correct = false;
+		}
+		++count;
+	}
+	HTEST_ASSERT(correct, "");
+	HTEST_ASSERT(count == 2500, "");
+}
+
+HTEST_CASE(clusteredKeys)
+{
+	// keys that only differ in their high bits must not end up in the same slots
+	hhashmap<int, int> a;
+	for_iter (i, 0, 2000)
+	{
+		a[i << 16] = i;
+	}
+	HTEST_ASSERT(a.size() == 2000, "");
+	HTEST_ASSERT(a.getCapacity() <= 4096, "");
+	bool correct = true;
+	for_iter (i, 0, 2000)
+	{
+		if (a.tryGet(i << 16, -1) != i)
+		{
+			correct = false;
+		}
+	}
+	HTEST_ASSERT(correct, "");
+	hhashmap<int*, int> b;
+	for_iter (i, 0, 2000)
+	{
+		b[(int*)((size_t)i << 20)] = i;
+	}
+	HTEST_ASSERT(b.size() == 2000, "");
+	HTEST_ASSERT(b.getCapacity() <= 4096, "");
+}
+
+HTEST_CASE(comparison)
+{
+	hhashmap<hstr, int> a;
+	hhashmap<hstr, int> b;
+	a["a"] = 1;
+	a["b"] = 2;
+	b["b"] = 2;
+	b["a"] = 1;
+	HTEST_ASSERT(a == b, "");
+	b["a"] = 3;
+	HTEST_ASSERT(a != b, "");
+	b.removeKey("a");
+	HTEST_ASSERT(a != b, "");
+	hhashmap<hstr, int> c(a);
+	HTEST_ASSERT(a == c, "");
+	c += b;
+	HTEST_ASSERT(c.size() == 2, "");
+	b["c"] = 4;
+	c.inject(b);
+	HTEST_ASSERT(c.size() == 3, "");
+	HTEST_ASSERT(c["c"] == 4, "");
+}
+
+HTEST_CASE(random)
+{
+	hhashmap<int, int> a;
+	for_iter (i, 0, 10)
+	{
+		a[i] = i * 2;
+	}
+	int value = 0;
+	int key = a.random(&value);
+	HTEST_ASSERT(value == key * 2, "");
+	hhashmap<int, int> b = a.random(4);
+	HTEST_ASSERT(b.size() == 4, "");
+	HTEST_ASSERT(a.hasAllKeys(b.keys()), "");
+	key = a.removeRandom(&value);
+	HTEST_ASSERT(a.size() == 9, "");
+	HTEST_ASSERT(!a.hasKey(key), "");
+	HTEST_ASSERT(value == key * 2, "");
+	b = a.removeRandom(3);
+	HTEST_ASSERT(a.size() == 6, "");
+	HTEST_ASSERT(b.size() == 3, "");
+	HTEST_ASSERT(!a.hasAnyKey(b.keys()), "");
+}
+
+HTEST_CASE(move)
+{
+	hhashmap<hstr, harray<int> > a;
+	a["a"] += 1;
+	a["a"] += 2;
+	a.insert(hstr("b"), harray<int>());
+	hhashmap<hstr, harray<int> > b(std::move(a));
+	HTEST_ASSERT(a.size() == 0, "");
+	HTEST_ASSERT(b.size() == 2, "");
+	HTEST_ASSERT(b["a"].size() == 2, "");
+	a = std::move(b);
+	HTEST_ASSERT(a.size() == 2, "");
+	HTEST_ASSERT(a.hasKey("b"), "");
+	a["c"] = harray<int>();
+	HTEST_ASSERT(a.size() == 3, "");
+	HTEST_ASSERT((std::is_nothrow_move_constructible<hhashmap<hstr, harray<int> > >::value), "");
+	HTEST_ASSERT((std::is_nothrow_move_assignable<hhashmap<hstr, harray<int> > >::value), "");
+}
+
+HTEST_SUITE_END
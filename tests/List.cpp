@@ -256,13 +256,11 @@ HTEST_CASE(operations)
 	b += 1;
 	b += 2;
 	HTEST_ASSERT(a == b, "clear()");
-#ifndef __APPLE__ // stable_sort fails to compile on Mac for some reason, disabling this test for now
 	a.sort();
 	HTEST_ASSERT(a == b.sorted(), "sorted()");
 	HTEST_ASSERT(a != b, "");
 	b.sort();
 	HTEST_ASSERT(a == b, "sort()");
-#endif
 	HTEST_ASSERT(a.min() == 1, "");
 	HTEST_ASSERT(b.max() == 5, "");
 }
@@ -441,6 +439,31 @@ HTEST_CASE(random)
 	HTEST_ASSERT(b.size() == 2, "");
 	HTEST_ASSERT(a.has(b), "");
 	HTEST_ASSERT(!b.has(a), "");
+	HTEST_ASSERT(b.first() != b.last(), "random() unique");
+	hlist<int> c = a.randomized();
+	HTEST_ASSERT(c.size() == a.size() && c.has(a), "randomized()");
+	c.sort();
+	HTEST_ASSERT(c == a, "randomized() sort()");
+}
+
+HTEST_CASE(linearAlgorithms)
+{
+	hlist<int> a;
+	for_iter (i, 0, 20000)
+	{
+		a += i % 100;
+	}
+	HTEST_ASSERT(a.indexOf(99) == 99 && a.indexOf(100) == -1, "indexOf()");
+	HTEST_ASSERT(a.count(5) == 200, "count()");
+	HTEST_ASSERT(a.removeAll(5) == 200 && !a.has(5), "removeAll()");
+	hlist<int> b;
+	b += 7;
+	b += 8;
+	HTEST_ASSERT(a.removeAll(b) == 400 && a.size() == 19400, "removeAll() other");
+	a.remove(0);
+	HTEST_ASSERT(a.first() == 1 && a.count(0) == 199, "remove()");
+	hlist<int> c = a(0, 3);
+	HTEST_ASSERT(c.joined(",") == "1,2,3", "joined()");
 }
 
 HTEST_CASE(cast)
@@ -1,6 +1,7 @@
 #define _HTEST_LIB hltypes
 #define _HTEST_CLASS Map
 #include <htest/htest.h>
+#include "hbimap.h"
 #include "hmap.h"
 #include "hstring.h"
 
@@ -191,6 +192,11 @@ HTEST_CASE(match)
 	HTEST_ASSERT(!c.matchesAny(&negative_keys), "");
 	HTEST_ASSERT(c.matchesAny(&positive_values), "");
 	HTEST_ASSERT(c.matchesAll(&positive_values), "");
+	int limit = 9000;
+	c = a.findAll([limit](hstr const& key, int const& value) { return ((int)key > limit); });
+	HTEST_ASSERT(c.size() == 2, "");
+	HTEST_ASSERT(c.matchesAll([limit](hstr const& key, int const& value) { return ((int)key > limit); }), "");
+	HTEST_ASSERT(!c.matchesAny([](hstr const& key, int const& value) { return (value == 0); }), "");
 }
 
 HTEST_CASE(cast)
@@ -216,4 +222,46 @@ HTEST_CASE(cast)
 	HTEST_ASSERT(b[-54321] == "-3", "");
 }
 
+HTEST_CASE(move)
+{
+	hmap<hstr, hstr> a;
+	a.insert("a", "1");
+	a.insert(hstr("b"), hstr("2"));
+	hstr value('x', 100);
+	const char* data = value.cStr();
+	a.insert("a", std::move(value));
+	HTEST_ASSERT(a.size() == 2 && a["a"].cStr() == data && a["b"] == "2", "insert()");
+	hmap<hstr, hstr> b = std::move(a);
+	HTEST_ASSERT(b.size() == 2 && a.size() == 0, "move constructor");
+	harray<hstr> values = hmap<hstr, hstr>(b).values();
+	HTEST_ASSERT(values.size() == 2 && values[0].size() == 100, "values() &&");
+	HTEST_ASSERT(b.values(hstr("b,a").split(',')).first() == "2", "values(keys)");
+}
+
+HTEST_CASE(biMap)
+{
+	hbimap<hstr, int> a;
+	a.insert("a", 1);
+	a.insert("b", 2);
+	a.insert("c", 3);
+	HTEST_ASSERT(a.size() == 3, "");
+	HTEST_ASSERT(a.valueOf("b") == 2, "");
+	HTEST_ASSERT(a.keyOf(3) == "c", "");
+	HTEST_ASSERT(a(1) == "a", "");
+	HTEST_ASSERT(a.hasValue(2) && !a.hasValue(4), "");
+	HTEST_ASSERT(a.tryGetKey(4, "none") == "none", "");
+	// replacing an entry has to remove the old pairing in both directions
+	a.insert("a", 2);
+	HTEST_ASSERT(a.size() == 2, "");
+	HTEST_ASSERT(a.keyOf(2) == "a", "");
+	HTEST_ASSERT(!a.hasKey("b") && !a.hasValue(1), "");
+	HTEST_ASSERT(a.removeValue(3), "");
+	HTEST_ASSERT(!a.hasKey("c"), "");
+	HTEST_ASSERT(a.getReverse().size() == 1, "");
+	hmap<hstr, int> b;
+	b["x"] = 5;
+	b["y"] = 6;
+	HTEST_ASSERT((hbimap<hstr, int>(b).getForward() == b), "");
+}
+
 HTEST_SUITE_END
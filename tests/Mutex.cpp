@@ -2,7 +2,14 @@
 #define _HTEST_CLASS Mutex
 #include <htest/htest.h>
 
+#include "hbarrier.h"
+#include "hconditionvariable.h"
+#include "hevent.h"
+#include "hlatch.h"
 #include "hmutex.h"
+#include "hreadwritemutex.h"
+#include "hsemaphore.h"
+#include "hspinmutex.h"
 #include "hthread.h"
 
 static int test1 = 1;
@@ -32,6 +39,96 @@ static void _thread2(hthread* t)
 	testResult2 = testResult2 + 1;
 }
 
+static hmutex conditionMutex;
+static hconditionvariable condition;
+static bool conditionFlag = false;
+
+static void _conditionThread(hthread* t)
+{
+	hmutex::ScopeLock lock(&conditionMutex);
+	conditionFlag = true;
+	condition.signal();
+}
+
+static hevent event1;
+static hlatch* latch1 = NULL;
+
+static void _eventThread(hthread* t)
+{
+	event1.wait();
+	latch1->countDown();
+}
+
+#define BARRIER_THREADS 4
+#define BARRIER_PHASES 3
+static hbarrier barrier1(BARRIER_THREADS);
+static hmutex barrierMutex;
+static int barrierArrived[BARRIER_PHASES];
+static int barrierLast = 0;
+static bool barrierValid = true;
+
+static void _barrierThread(hthread* t)
+{
+	hmutex::ScopeLock lock;
+	for (int i = 0; i < BARRIER_PHASES; ++i)
+	{
+		lock.acquire(&barrierMutex);
+		++barrierArrived[i];
+		lock.release();
+		bool last = barrier1.wait();
+		lock.acquire(&barrierMutex);
+		if (last)
+		{
+			++barrierLast;
+		}
+		if (barrierArrived[i] != BARRIER_THREADS)
+		{
+			barrierValid = false;
+		}
+		lock.release();
+	}
+	latch1->countDown();
+}
+
+static hreadwritemutex readWriteMutex1;
+static hspinmutex spinMutex1;
+static int sharedValue = 0;
+static bool sharedValid = true;
+
+static void _readWriteThread(hthread* t)
+{
+	for (int i = 0; i < 1000; ++i)
+	{
+		hreadwritemutex::WriteScopeLock writeLock(&readWriteMutex1);
+		sharedValue += 2;
+		writeLock.release();
+		hreadwritemutex::ReadScopeLock readLock(&readWriteMutex1);
+		if (sharedValue % 2 != 0)
+		{
+			sharedValid = false;
+		}
+	}
+	latch1->countDown();
+}
+
+static void _spinThread(hthread* t)
+{
+	for (int i = 0; i < 10000; ++i)
+	{
+		hspinmutex::ScopeLock lock(&spinMutex1);
+		++sharedValue;
+	}
+	latch1->countDown();
+}
+
+static hsemaphore* semaphore1 = NULL;
+
+static void _semaphoreThread(hthread* t)
+{
+	hthread::sleep(10.0f);
+	semaphore1->unlock();
+}
+
 HTEST_SUITE_BEGIN
 
 HTEST_CASE(lockRelease)
@@ -74,4 +171,163 @@ HTEST_CASE(massLockRelease)
 	HTEST_ASSERT(testResult2 == 10, hstr(testResult2).cStr());
 }
 
+HTEST_CASE(conditionVariable)
+{
+	conditionFlag = false;
+	hmutex::ScopeLock lock(&conditionMutex);
+	HTEST_ASSERT(!condition.wait(&lock, 10.0f), "timeout");
+	hthread t(&_conditionThread);
+	t.start();
+	while (!conditionFlag)
+	{
+		condition.wait(&lock);
+	}
+	lock.release();
+	t.join();
+	HTEST_ASSERT(conditionFlag, "signal");
+}
+
+HTEST_CASE(event)
+{
+	HTEST_ASSERT(!event1.isSet(), "initial");
+	HTEST_ASSERT(!event1.wait(10.0f), "timeout");
+	hlatch latch(4);
+	latch1 = &latch;
+	hthread* t[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		t[i] = new hthread(&_eventThread);
+		t[i]->start();
+	}
+	HTEST_ASSERT(!latch.wait(10.0f), "blocked");
+	event1.set();
+	latch.wait();
+	HTEST_ASSERT(latch.getCount() == 0, "released");
+	HTEST_ASSERT(event1.isSet(), "manual reset");
+	event1.reset();
+	HTEST_ASSERT(!event1.isSet(), "reset");
+	for (int i = 0; i < 4; ++i)
+	{
+		t[i]->join();
+		delete t[i];
+	}
+	hevent autoEvent(true);
+	autoEvent.set();
+	HTEST_ASSERT(autoEvent.wait(0.0f), "auto reset set");
+	HTEST_ASSERT(!autoEvent.isSet(), "auto reset");
+	HTEST_ASSERT(!autoEvent.wait(0.0f), "auto reset timeout");
+}
+
+HTEST_CASE(latch)
+{
+	hlatch latch(3);
+	HTEST_ASSERT(latch.getCount() == 3, "count");
+	latch.countDown();
+	HTEST_ASSERT(!latch.wait(0.0f), "timeout");
+	latch.countDown(5);
+	HTEST_ASSERT(latch.getCount() == 0, "count down");
+	HTEST_ASSERT(latch.wait(0.0f), "released");
+	latch.wait();
+}
+
+HTEST_CASE(barrier)
+{
+	for (int i = 0; i < BARRIER_PHASES; ++i)
+	{
+		barrierArrived[i] = 0;
+	}
+	barrierLast = 0;
+	barrierValid = true;
+	hlatch latch(BARRIER_THREADS);
+	latch1 = &latch;
+	hthread* t[BARRIER_THREADS];
+	for (int i = 0; i < BARRIER_THREADS; ++i)
+	{
+		t[i] = new hthread(&_barrierThread);
+		t[i]->start();
+	}
+	// join() doesn't run threads that haven't started yet so all threads have to finish first
+	latch.wait();
+	for (int i = 0; i < BARRIER_THREADS; ++i)
+	{
+		t[i]->join();
+		delete t[i];
+	}
+	HTEST_ASSERT(barrierValid, "phases");
+	HTEST_ASSERT(barrierLast == BARRIER_PHASES, hstr(barrierLast).cStr());
+}
+
+HTEST_CASE(readWriteMutex)
+{
+	sharedValue = 0;
+	sharedValid = true;
+	hlatch latch(4);
+	latch1 = &latch;
+	hthread* t[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		t[i] = new hthread(&_readWriteThread);
+		t[i]->start();
+	}
+	latch.wait();
+	for (int i = 0; i < 4; ++i)
+	{
+		t[i]->join();
+		delete t[i];
+	}
+	HTEST_ASSERT(sharedValid, "consistent reads");
+	HTEST_ASSERT(sharedValue == 8000, hstr(sharedValue).cStr());
+	hreadwritemutex::ReadScopeLock readLock(&readWriteMutex1);
+	HTEST_ASSERT(!readWriteMutex1.tryLockWrite(), "write while reading");
+	readLock.release();
+	HTEST_ASSERT(readWriteMutex1.tryLockWrite(), "write");
+	HTEST_ASSERT(!readWriteMutex1.tryLockRead(), "read while writing");
+	readWriteMutex1.unlockWrite();
+}
+
+HTEST_CASE(spinMutex)
+{
+	sharedValue = 0;
+	hlatch latch(4);
+	latch1 = &latch;
+	hthread* t[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		t[i] = new hthread(&_spinThread);
+		t[i]->start();
+	}
+	latch.wait();
+	for (int i = 0; i < 4; ++i)
+	{
+		t[i]->join();
+		delete t[i];
+	}
+	HTEST_ASSERT(sharedValue == 40000, hstr(sharedValue).cStr());
+	HTEST_ASSERT(spinMutex1.tryLock(), "lock");
+	HTEST_ASSERT(!spinMutex1.tryLock(), "locked");
+	spinMutex1.unlock();
+}
+
+HTEST_CASE(semaphore)
+{
+	// unnamed semaphores can share names
+	hsemaphore semaphore(2, "test");
+	hsemaphore other(1, "test");
+	semaphore1 = &semaphore;
+	HTEST_ASSERT(semaphore.tryLock(), "first");
+	HTEST_ASSERT(semaphore.lock(0.0f), "second");
+	HTEST_ASSERT(!semaphore.tryLock(), "exhausted");
+	HTEST_ASSERT(!semaphore.lock(10.0f), "timeout");
+	HTEST_ASSERT(other.tryLock(), "other");
+	hthread t(&_semaphoreThread);
+	t.start();
+	HTEST_ASSERT(semaphore.lock(10000.0f), "unlocked");
+	t.join();
+	semaphore.unlock();
+	semaphore.lock();
+	semaphore.unlock();
+	semaphore.unlock();
+	other.unlock();
+}
+
 HTEST_SUITE_END
@@ -1,8 +1,13 @@
 #define _HTEST_LIB hltypes
 #define _HTEST_CLASS String
 #include <htest/htest.h>
+#include <type_traits>
+#include <vector>
 #include "harray.h"
+#include "hatom.h"
+#include "hmap.h"
 #include "hstring.h"
+#include "hstringbuilder.h"
 
 HTEST_SUITE_BEGIN
 
@@ -115,6 +120,40 @@ HTEST_CASE(replace)
 	HTEST_ASSERT(s3 == "this is a test", "replace4");
 }
 
+HTEST_CASE(replaceMultiple)
+{
+	hstr s1 = "aaa-aa";
+	s1.replace("a", "bb", 2);
+	HTEST_ASSERT(s1 == "bbbba-aa", "replaceMultiple1");
+	s1.replace('a', 'c');
+	HTEST_ASSERT(s1 == "bbbbc-cc", "replaceMultiple2");
+	s1.replace("bb", 'x', 3);
+	HTEST_ASSERT(s1 == "xxxxxxc-cc", "replaceMultiple3");
+	hmap<hstr, hstr> replacements;
+	replacements["{name}"] = "World";
+	replacements["{"] = "<";
+	replacements["{{"] = "{";
+	replacements["<"] = "&lt;";
+	hstr s2 = "Hello {name}! {{name} < {";
+	HTEST_ASSERT(s2.replaced(replacements) == "Hello World! {name} &lt; <", "replaceMultiple4");
+	replacements.clear();
+	replacements["he"] = "1";
+	replacements["she"] = "2";
+	replacements["hers"] = "3";
+	replacements["his"] = "4";
+	HTEST_ASSERT(hstr("ushers shis").replaced(replacements) == "u2rs s4", "replaceMultiple5");
+	HTEST_ASSERT(hstr("ushe").replaced(replacements) == "u2", "replaceMultiple6");
+	HTEST_ASSERT(hstr("nothing").replaced(replacements) == "nothing", "replaceMultiple7");
+	replacements.clear();
+	replacements["abcd"] = "1";
+	replacements["ab"] = "2";
+	replacements["c"] = "3";
+	replacements["cde"] = "4";
+	replacements["bc"] = "5";
+	HTEST_ASSERT(hstr("abcex abcdex abcdef").replaced(replacements) == "23ex 1ex 1ef", "replaceMultiple8");
+	HTEST_ASSERT(hstr("xbcde cdcde").replaced(replacements) == "x5de 3d4", "replaceMultiple9");
+}
+
 HTEST_CASE(insertAt)
 {
 	hstr s1 = "123456789";
@@ -366,6 +405,11 @@ HTEST_CASE(count)
 	HTEST_ASSERT(s.count("1") == 3, "count2");
 	HTEST_ASSERT(s.count('1') == 3, "count3");
 	HTEST_ASSERT(s.count('5') == 0, "count4");
+	HTEST_ASSERT(s.count("") == 0, "count5");
+	HTEST_ASSERT(s.count("1122223") == 1, "count6");
+	HTEST_ASSERT(s.count("111222234") == 0, "count7");
+	HTEST_ASSERT(hstr().count("") == 0, "count8");
+	HTEST_ASSERT(hstr().count('1') == 0, "count9");
 }
 
 HTEST_CASE(startsWith)
@@ -393,6 +437,10 @@ HTEST_CASE(contains)
 	HTEST_ASSERT(!s1.containsAny("dfgjkl"), "contains6");
 	HTEST_ASSERT(s1.containsAll("tisae"), "contains7");
 	HTEST_ASSERT(!s1.containsAll("dfgjkl"), "contains8");
+	HTEST_ASSERT(s1.contains("this is a test"), "contains9");
+	HTEST_ASSERT(!s1.contains("this is a test!"), "contains10");
+	HTEST_ASSERT(s1.indexOfAny("xa ") == 4, "contains11");
+	HTEST_ASSERT(s1.indexOf("t", 1) == 10, "contains12");
 }
 
 HTEST_CASE(isNumeric)
@@ -458,10 +506,84 @@ HTEST_CASE(hex)
 	HTEST_ASSERT(s2.unhex() == 0x74657374, "hex5");
 }
 
+HTEST_CASE(move)
+{
+	HTEST_ASSERT(std::is_nothrow_move_constructible<hstr>::value, "move1");
+	HTEST_ASSERT(std::is_nothrow_move_assignable<hstr>::value, "move2");
+	// reallocating a std::vector has to move the strings instead of copying them
+	std::vector<hstr> strings;
+	strings.push_back(hstr('x', 100));
+	const char* data = strings[0].cStr();
+	for_iter (i, 0, 100)
+	{
+		strings.push_back(hstr(i));
+	}
+	HTEST_ASSERT(strings[0].cStr() == data, "move3");
+}
+
+HTEST_CASE(concatenation)
+{
+	hstr s1 = "abc";
+	hstr s2 = s1 + "def";
+	HTEST_ASSERT(s1 == "abc", "concatenation1");
+	HTEST_ASSERT(s2 == "abcdef", "concatenation2");
+	hstr s3 = "[" + s1 + ':' + hstr(15) + "] " + s2;
+	HTEST_ASSERT(s3 == "[abc:15] abcdef", "concatenation3");
+	hstr s4 = (s1 = "xyz");
+	HTEST_ASSERT(s1 == "xyz" && s4 == "xyz", "concatenation4");
+	hstr s5 = hstr("moved");
+	s4 = hstr("moved") + s1;
+	HTEST_ASSERT(s5 == "moved" && s4 == "movedxyz", "concatenation5");
+}
+
+HTEST_CASE(stringBuilder)
+{
+	hstrbuilder builder(4);
+	builder.add('[').add("file.cpp").add(':').add(42).add("] ");
+	HTEST_ASSERT(builder.str() == "[file.cpp:42] ", "stringBuilder1");
+	builder << hstr("message") << ' ' << 1.5f << ' ' << 2.0 << ' ' << (int64_t)-3 << ' ' << true;
+	HTEST_ASSERT(builder.str() == "[file.cpp:42] message 1.5 2 -3 true", "stringBuilder2");
+	HTEST_ASSERT(builder.size() == builder.str().size(), "stringBuilder3");
+	builder.clear();
+	HTEST_ASSERT(builder.size() == 0 && builder.str() == "", "stringBuilder4");
+	builder.add('-', 3).add(hstr("abcdef"), 2).add(1.75f, 2);
+	HTEST_ASSERT(hstr(builder.cStr()) == "---ab1.75", "stringBuilder5");
+	builder.reserve(1000);
+	HTEST_ASSERT(builder.getCapacity() >= 1000 && builder.str() == "---ab1.75", "stringBuilder6");
+}
+
+HTEST_CASE(atom)
+{
+	hatom tag("render");
+	hatom same(hstr("render"));
+	hatom other("Render");
+	HTEST_ASSERT(tag == same && tag.getId() == same.getId() && tag.getHash() == same.getHash(), "atom1");
+	HTEST_ASSERT(&tag.str() == &same.str(), "atom2");
+	HTEST_ASSERT(tag != other && tag == "render" && tag != hstr("Render"), "atom3");
+	HTEST_ASSERT(hatom() == hatom("") && hatom().size() == 0, "atom4");
+	HTEST_ASSERT(hatom("render_target", 6) == tag, "atom5");
+	int count = hatom::getCount();
+	hatom("render");
+	HTEST_ASSERT(hatom::getCount() == count, "atom6");
+	hmap<hatom, int> values;
+	values[tag] = 1;
+	values[other] = 2;
+	values[hatom("render")] += 10;
+	HTEST_ASSERT(values.size() == 2 && values[same] == 11 && values[hatom("Render")] == 2, "atom7");
+	const hstr& string = tag;
+	HTEST_ASSERT(string == "render" && hstr("[") + tag + "]" == "[render]", "atom8");
+}
+
 HTEST_CASE(formatting)
 {
 	hstr text = hsprintf("This is a %d %s %4.2f %s.", 15, "formatted", 3.14f, "text");
 	HTEST_ASSERT(text == "This is a 15 formatted 3.14 text.", "hsprintf");
+	hstr longText('x', 300);
+	text = hsprintf("[%s]", longText.cStr());
+	HTEST_ASSERT(text == "[" + longText + "]", "hsprintf long");
+	hstr veryLongText('y', 100000);
+	text = hsprintf("%s%d", veryLongText.cStr(), 5);
+	HTEST_ASSERT(text.size() == 100001 && text.endsWith("y5"), "hsprintf very long");
 }
 
 HTEST_SUITE_END
@@ -1,7 +1,9 @@
 #define _HTEST_LIB hltypes
 #define _HTEST_CLASS Thread
 #include <htest/htest.h>
+#include "hlatch.h"
 #include "hthread.h"
+#include "hthreadpool.h"
 #include "hmutex.h"
 
 
@@ -81,4 +83,166 @@ HTEST_CASE(testThreadingControl)
 	HTEST_ASSERT(output.count('2') == 10, "threading control 2");
 }
 
+static int attributesCore = -2;
+static hlatch* attributesLatch = NULL;
+
+static void _attributes(hthread* t)
+{
+	attributesCore = hthread::getCurrentCore();
+	attributesLatch->countDown();
+}
+
+HTEST_CASE(attributes)
+{
+	int core = hthread::getCurrentCore();
+	hthread::Attributes attributes(256 * 1024, (core >= 0 && core < 64 ? 1ULL << core : 0ULL), 5);
+	hthread t(&_attributes, "attributes", attributes);
+	HTEST_ASSERT(t.getAttributes().stackSize == 256 * 1024, "");
+	hlatch latch(1);
+	attributesLatch = &latch;
+	t.start();
+	latch.wait();
+	t.join();
+	// the thread may only run on the core of the calling thread, -1 means that the platform can't tell
+	HTEST_ASSERT(attributesCore == core, hstr(attributesCore).cStr());
+}
+
+static void _cancelable(hthread* t)
+{
+	while (!t->isCancelRequested())
+	{
+		hthread::sleep(1.0f);
+	}
+}
+
+HTEST_CASE(cancel)
+{
+	hthread t(&_cancelable);
+	HTEST_ASSERT(t.join(0.0f), "not started");
+	t.start();
+	HTEST_ASSERT(!t.join(10.0f), "timeout");
+	HTEST_ASSERT(t.isRunning() && !t.isCancelRequested(), "");
+	t.requestCancel();
+	HTEST_ASSERT(t.join(10000.0f), "canceled");
+	HTEST_ASSERT(!t.isRunning() && !t.isExecuting(), "");
+	t.start();
+	HTEST_ASSERT(!t.isCancelRequested(), "restart");
+	t.requestCancel();
+	HTEST_ASSERT(t.join(10000.0f), "canceled again");
+}
+
+static int restartCount = 0;
+
+static void _restart(hthread* t)
+{
+	++restartCount;
+}
+
+HTEST_CASE(restart)
+{
+	restartCount = 0;
+	hthread t(&_restart);
+	for_iter (i, 0, 3)
+	{
+		// the previous run returned on its own and was never joined, start() has to reap it
+		t.start();
+		while (t.isRunning())
+		{
+			hthread::sleep(1.0f);
+		}
+	}
+	HTEST_ASSERT(restartCount == 3, hstr(restartCount).cStr());
+	t.join();
+	HTEST_ASSERT(restartCount == 3, hstr(restartCount).cStr());
+}
+
+static int _fibonacci(hthreadpool* pool, int n)
+{
+	if (n < 2)
+	{
+		return n;
+	}
+	hthreadpool::Future<int> first = pool->submit([pool, n]() { return _fibonacci(pool, n - 1); });
+	int second = _fibonacci(pool, n - 2);
+	return (first.get() + second);
+}
+
+struct _NoDefault
+{
+	int value;
+
+	_NoDefault(int value) : value(value)
+	{
+	}
+
+};
+
+HTEST_CASE(threadPool)
+{
+	hthreadpool pool(4, "test pool");
+	HTEST_ASSERT(pool.getWorkerCount() == 4, "");
+	harray<hthreadpool::Future<int> > futures;
+	for_iter (i, 0, 100)
+	{
+		futures += pool.submit([i]() { return (i * i); });
+	}
+	int sum = 0;
+	for_iter (i, 0, futures.size())
+	{
+		sum += futures[i].get();
+	}
+	HTEST_ASSERT(sum == 328350, "");
+	HTEST_ASSERT(_fibonacci(&pool, 15) == 610, "nested tasks");
+	hthreadpool::Future<void> failed = pool.submit([]() { throw Exception("task failed"); });
+	bool thrown = false;
+	try
+	{
+		failed.get();
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown, "");
+	hthreadpool::Future<_NoDefault> noDefault = pool.submit([]() { return _NoDefault(7); });
+	HTEST_ASSERT(noDefault.get().value == 7, "result without default constructor");
+	hthreadpool::Future<int> invalid;
+	HTEST_ASSERT(!invalid.isValid() && !invalid.isFinished(), "invalid future");
+	thrown = false;
+	try
+	{
+		invalid.get();
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown, "invalid future get()");
+	pool.waitAll();
+	HTEST_ASSERT(pool.getPendingCount() == 0, "");
+}
+
+HTEST_CASE(threadPoolParallelFor)
+{
+	hthreadpool pool(3);
+	harray<int> values(0, 1000);
+	pool.parallelFor(0, values.size(), 64, [&values](int i) { values[i] = i * 2; });
+	bool correct = true;
+	for_iter (i, 0, values.size())
+	{
+		correct &= (values[i] == i * 2);
+	}
+	HTEST_ASSERT(correct, "");
+	bool thrown = false;
+	try
+	{
+		pool.parallelFor(0, 100, 10, [](int i) { if (i == 55) throw Exception("index failed"); });
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown, "");
+}
+
 HTEST_SUITE_END